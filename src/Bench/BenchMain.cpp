@@ -0,0 +1,168 @@
+#include "stdafx.h"
+#include "HeadlessSimulation.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Managers/InputManager.h"
+#include "Core/Memory/MemoryTracker.h"
+#include <iomanip>
+
+// ********************* BENCHMARK DEFAULTS ********************
+constexpr int DEFAULT_TICKS = 1200;              // 10 seconds of game time at 120 Hz
+constexpr float TICK_RATE = 120.0f;              // Same tick rate as GameInstance
+constexpr unsigned int DEFAULT_SEED = 1337;
+const std::vector<int> DEFAULT_ENEMY_COUNTS = { 45, 1000, 10000 };
+// ****************************************************
+
+namespace
+{
+	/**
+	 * @brief Prints one row of the per-phase table, as average microseconds per tick.
+	 */
+	void PrintRow(int enemyCount, const HeadlessSimulation& simulation)
+	{
+		const PhaseTimings& timings = simulation.GetTimings();
+		const double ticks = static_cast<double>(simulation.GetTickCount());
+		const double toMicroseconds = 1000000.0 / ticks;
+
+		std::cout << std::setw(8) << enemyCount
+			<< std::setw(12) << std::fixed << std::setprecision(0) << ticks / timings.Total()
+			<< std::setprecision(2)
+			<< std::setw(10) << timings.input * toMicroseconds
+			<< std::setw(11) << timings.spaceship * toMicroseconds
+			<< std::setw(10) << timings.enemies * toMicroseconds
+			<< std::setw(12) << timings.collisions * toMicroseconds
+			<< std::setw(9) << timings.respawn * toMicroseconds
+			<< std::setw(10) << timings.Total() * toMicroseconds
+			<< std::setw(7) << simulation.GetWaveCount()
+			<< std::setw(7) << simulation.GetPlayerHits()
+			<< std::endl;
+	}
+}
+
+/**
+ * @brief Entry point of the headless benchmark.
+ *
+ * Usage: Bench [--workers=N] [--record=file | --replay=file] [ticks] [enemyCount...]
+ * Runs one seeded simulation per enemy count (45, 1000 and 10000 by default) for the given number of ticks and prints
+ * the ticks per second and the average time per tick of every phase, in microseconds. --workers sets the number of
+ * JobSystem threads besides the main one (one per spare core by default), to measure how the phases scale.
+ * --record saves the scripted input and seed of the first simulation; --replay runs every simulation from a saved
+ * session instead, with its seed and for its number of ticks, so two builds can be compared on the same input.
+ *
+ * @return int Returns 0 on success, 1 on invalid arguments.
+ */
+int main(int argc, char** argv)
+{
+	int ticks = DEFAULT_TICKS;
+	std::vector<int> enemyCounts = DEFAULT_ENEMY_COUNTS;
+	int workerCount = -1;
+	std::string recordPath;
+	std::string replayPath;
+
+	// Options may come anywhere, the remaining arguments are positional
+	const std::string workersOption = "--workers=";
+	const std::string recordOption = "--record=";
+	const std::string replayOption = "--replay=";
+	std::vector<const char*> arguments;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument.rfind(workersOption, 0) == 0)
+		{
+			workerCount = std::atoi(argv[i] + workersOption.size());
+		}
+		else if (argument.rfind(recordOption, 0) == 0)
+		{
+			recordPath = argument.substr(recordOption.size());
+		}
+		else if (argument.rfind(replayOption, 0) == 0)
+		{
+			replayPath = argument.substr(replayOption.size());
+		}
+		else
+		{
+			arguments.push_back(argv[i]);
+		}
+	}
+
+	if (!arguments.empty())
+	{
+		ticks = std::atoi(arguments[0]);
+	}
+
+	if (arguments.size() > 1)
+	{
+		enemyCounts.clear();
+		for (std::size_t i = 1; i < arguments.size(); ++i)
+		{
+			enemyCounts.push_back(std::atoi(arguments[i]));
+		}
+	}
+
+	if (ticks <= 0 || std::any_of(enemyCounts.begin(), enemyCounts.end(), [](int count) { return count <= 0; })
+		|| (!recordPath.empty() && !replayPath.empty()))
+	{
+		std::cerr << "Usage: Bench [--workers=N] [--record=file | --replay=file] [ticks] [enemyCount...]" << std::endl;
+		return 1;
+	}
+
+	InputManager& input = InputManager::Get();
+	std::uint64_t seed = DEFAULT_SEED;
+	float tickRate = TICK_RATE;
+	if (!replayPath.empty())
+	{
+		// Load once to validate the file and learn its length and seed, every simulation restarts it
+		if (!input.StartPlayback(replayPath))
+		{
+			return 1;
+		}
+		seed = input.GetSessionSeed();
+		ticks = static_cast<int>(input.GetPlaybackTickCount());
+		tickRate = input.GetPlaybackTickRate();
+	}
+
+	if (workerCount >= 0)
+	{
+		JobSystem::Get().SetWorkerCount(static_cast<unsigned int>(workerCount));
+	}
+
+	std::cout << "Headless benchmark: " << ticks << " ticks at " << tickRate << " Hz, seed " << seed
+		<< ", " << JobSystem::Get().GetWorkerCount() << " job workers";
+	if (!replayPath.empty())
+	{
+		std::cout << ", replaying " << replayPath;
+	}
+	std::cout << std::endl;
+	std::cout << "Phase columns are the average time per tick, in microseconds" << std::endl;
+	std::cout << std::setw(8) << "enemies" << std::setw(12) << "ticks/sec"
+		<< std::setw(10) << "input" << std::setw(11) << "spaceship" << std::setw(10) << "enemies"
+		<< std::setw(12) << "collisions" << std::setw(9) << "respawn" << std::setw(10) << "total"
+		<< std::setw(7) << "waves" << std::setw(7) << "hits" << std::endl;
+
+	for (std::size_t i = 0; i < enemyCounts.size(); ++i)
+	{
+		// The scripted input does not depend on the enemy count, recording the first simulation is enough
+		const bool isRecording = !recordPath.empty() && i == 0;
+		if (isRecording)
+		{
+			input.SetSessionSeed(seed);
+			input.StartRecording(tickRate);
+		}
+		else if (!replayPath.empty() && i > 0)
+		{
+			input.StartPlayback(replayPath);
+		}
+
+		HeadlessSimulation simulation(enemyCounts[i], seed);
+		simulation.Run(ticks, 1.0f / tickRate);
+		PrintRow(enemyCounts[i], simulation);
+
+		if (isRecording && !input.StopRecording(recordPath))
+		{
+			return 1;
+		}
+	}
+
+	// The peaks are those of the largest simulation
+	MemoryTracker::Get().Report("benchmark");
+	return 0;
+}
@@ -0,0 +1,136 @@
+#include "stdafx.h"
+#include "HeadlessSimulation.h"
+#include "Core/Managers/InputManager.h"
+#include "Core/Managers/GameEventQueue.h"
+#include "Core/Utility/GameplayUtility.h"
+#include "Core/Utility/Strings.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Memory/FrameArena.h"
+#include <chrono>
+
+// ********************* SIMULATION CONSTANTS ********************
+constexpr int SCREEN_WIDTH = 1920;
+constexpr int SCREEN_HEIGHT = 1080;
+constexpr int CURSOR_HEIGHT = 900;               // Height the scripted cursor sweeps at
+constexpr float CURSOR_SWEEP_SPEED = 1.5f;       // Angular speed of the cursor sweep (rad/s)
+constexpr int SHOOT_PERIOD_TICKS = 6;            // The shoot button is pressed once every this many ticks
+constexpr int LEVEL_ONE_ENEMIES = 45;            // Waves up to this size use the LevelOne layout
+constexpr int DENSE_COLUMNS = 100;               // Columns of the grid used for larger waves
+constexpr std::size_t MIN_ENEMY_PROJECTILES = 4096;
+// ****************************************************
+
+namespace
+{
+	/**
+	 * @brief Gets the elapsed time between two points, in seconds.
+	 */
+	double SecondsBetween(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+	{
+		return std::chrono::duration<double>(end - start).count();
+	}
+}
+
+HeadlessSimulation::HeadlessSimulation(int enemyCount, std::uint64_t seed)
+	: m_Enemies(EGG, std::max(MIN_ENEMY_PROJECTILES, static_cast<std::size_t>(enemyCount) * 2))
+	, m_EnemyCount(enemyCount)
+	, m_ElapsedTime(0.0f)
+	, m_Tick(0)
+	, m_Waves(0)
+	, m_PlayerHits(0)
+{
+	m_Enemies.Seed(seed);
+	InputManager::Get().SetScripted(true);
+
+	SpawnWave();
+}
+
+HeadlessSimulation::~HeadlessSimulation()
+{
+	InputManager::Get().SetScripted(false);
+}
+
+void HeadlessSimulation::Run(int ticks, float deltaTime)
+{
+	for (int i = 0; i < ticks; ++i)
+	{
+		Tick(deltaTime);
+
+		// Every tick is a frame here
+		FrameArena::Get().Reset();
+		MemoryTracker::Get().EndFrame();
+	}
+}
+
+void HeadlessSimulation::Tick(float deltaTime)
+{
+	using Clock = std::chrono::steady_clock;
+
+	const Clock::time_point start = Clock::now();
+	ApplyScriptedInput();
+	InputManager::Get().Update(deltaTime);
+
+	const Clock::time_point inputDone = Clock::now();
+	m_Spaceship.Update(InputManager::Get().GetCursorPosition(), m_Enemies, deltaTime);
+
+	const Clock::time_point spaceshipDone = Clock::now();
+	m_Enemies.Update(deltaTime);
+
+	const Clock::time_point enemiesDone = Clock::now();
+	GameplayUtility::CheckEnemyCollision(m_Enemies, m_Spaceship.GetProjectiles(), m_EnemyGrid);
+	if (GameplayUtility::HasEnemyProjectileHitSpaceship(m_Enemies, m_Spaceship))
+	{
+		++m_PlayerHits;
+	}
+
+	const Clock::time_point collisionsDone = Clock::now();
+	if (m_Enemies.IsEmpty())
+	{
+		SpawnWave();
+	}
+
+	const Clock::time_point end = Clock::now();
+	m_Timings.input += SecondsBetween(start, inputDone);
+	m_Timings.spaceship += SecondsBetween(inputDone, spaceshipDone);
+	m_Timings.enemies += SecondsBetween(spaceshipDone, enemiesDone);
+	m_Timings.collisions += SecondsBetween(enemiesDone, collisionsDone);
+	m_Timings.respawn += SecondsBetween(collisionsDone, end);
+
+	// Nothing consumes the gameplay events without audio, drop them as the game loop would after dispatching
+	GameEventQueue::Get().Clear();
+
+	m_ElapsedTime += deltaTime;
+	++m_Tick;
+}
+
+void HeadlessSimulation::ApplyScriptedInput()
+{
+	// Sweep left and right along the bottom of the screen
+	const float sweep = std::sin(m_ElapsedTime * CURSOR_SWEEP_SPEED);
+	const int cursorX = SCREEN_WIDTH / 2 + static_cast<int>(sweep * (SCREEN_WIDTH / 2 - 64));
+	InputManager::Get().SetScriptedCursor(Vector2i(cursorX, CURSOR_HEIGHT));
+
+	// Hold the button for one tick and release it, so every period registers as a new press
+	const bool isShooting = (m_Tick % SHOOT_PERIOD_TICKS) == 0;
+	InputManager::Get().SetScriptedKey(KeyBind::Shoot, isShooting);
+}
+
+void HeadlessSimulation::SpawnWave()
+{
+	m_Enemies.Clear();
+
+	if (m_EnemyCount <= LEVEL_ONE_ENEMIES)
+	{
+		// Same formation as LevelOne
+		GameplayUtility::EnemySpawner(m_Enemies, DifficultyLevel::VERY_EASY, m_EnemyCount, 15, 15, 130, 150);
+	}
+	else
+	{
+		// Pack larger waves into the visible area, overlapping if they have to
+		const int rows = (m_EnemyCount + DENSE_COLUMNS - 1) / DENSE_COLUMNS;
+		const int xSpacing = SCREEN_WIDTH / DENSE_COLUMNS;
+		const int ySpacing = std::max(1, (SCREEN_HEIGHT / 2) / rows);
+		GameplayUtility::EnemySpawner(m_Enemies, DifficultyLevel::VERY_EASY, m_EnemyCount, rows, DENSE_COLUMNS, xSpacing, ySpacing);
+	}
+
+	++m_Waves;
+}
@@ -0,0 +1,145 @@
+/*!
+ * \file HeadlessSimulation.h
+ *
+ * \brief Contains the HeadlessSimulation class, which runs LevelOne gameplay without a window or audio device.
+ *
+ * The simulation drives the same Spaceship, EnemyStore, ProjectilePool and GameplayUtility code as LevelOne, one
+ * fixed tick at a time. Input comes from a deterministic script through the InputManager, nothing is drawn (null
+ * renderer) and sounds are discarded (null audio, see MOO_HEADLESS). Every tick phase is timed separately, so the
+ * benchmark can report where the time goes.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "Entities/Spaceship.h"
+#include "Entities/EnemyStore.h"
+#include "Core/Utility/SpatialHashGrid.h"
+
+/**
+ * @struct PhaseTimings
+ * @brief Accumulated wall-clock time spent in each phase of a tick, in seconds.
+ */
+struct PhaseTimings
+{
+	double input = 0.0;      ///< Scripted input and InputManager update
+	double spaceship = 0.0;  ///< Spaceship movement, shooting and its projectiles
+	double enemies = 0.0;    ///< Enemy movement, shooting and their projectiles
+	double collisions = 0.0; ///< Broadphase build, enemy and spaceship hit tests
+	double respawn = 0.0;    ///< Respawning a wave once every enemy is dead
+
+	/**
+	 * @brief Gets the total time spent in all phases.
+	 *
+	 * @return The sum of every phase, in seconds.
+	 */
+	inline double Total() const { return input + spaceship + enemies + collisions + respawn; }
+};
+
+/**
+ * @class HeadlessSimulation
+ * @brief Runs LevelOne-style waves for a fixed number of ticks and measures each phase.
+ *
+ * The layout of a wave matches LevelOne for its own enemy count (45) and becomes a denser grid for larger counts, so
+ * the same simulation covers the shipped game and stress tests. Given the same seed and tick count, two runs simulate
+ * exactly the same game.
+ */
+class HeadlessSimulation
+{
+public:
+	/**
+	 * @brief Constructs the simulation and spawns the first wave.
+	 *
+	 * @param enemyCount The number of enemies in every wave.
+	 * @param seed The seed of every random generator involved.
+	 */
+	HeadlessSimulation(int enemyCount, std::uint64_t seed);
+
+	/**
+	 * @brief Restores the InputManager to polling the real devices.
+	 */
+	~HeadlessSimulation();
+
+	/**
+	 * @brief Runs a number of fixed ticks.
+	 *
+	 * @param ticks The number of ticks to simulate.
+	 * @param deltaTime The duration of one tick, in seconds.
+	 */
+	void Run(int ticks, float deltaTime);
+
+	// Getters
+
+	/**
+	 * @brief Gets the time spent in each phase since construction.
+	 *
+	 * @return The accumulated phase timings.
+	 */
+	inline const PhaseTimings& GetTimings() const { return m_Timings; }
+
+	/**
+	 * @brief Gets the number of ticks simulated so far.
+	 *
+	 * @return The tick count.
+	 */
+	inline int GetTickCount() const { return m_Tick; }
+
+	/**
+	 * @brief Gets the number of waves spawned so far, the first one included.
+	 *
+	 * @return The wave count.
+	 */
+	inline int GetWaveCount() const { return m_Waves; }
+
+	/**
+	 * @brief Gets the number of times an enemy projectile hit the spaceship.
+	 *
+	 * @return The hit count.
+	 */
+	inline int GetPlayerHits() const { return m_PlayerHits; }
+
+	/**
+	 * @brief Gets the number of enemies still alive.
+	 *
+	 * @return The enemy count.
+	 */
+	inline std::size_t GetEnemyCount() const { return m_Enemies.Size(); }
+
+private:
+	/**
+	 * @brief Runs one tick, in the same order as LevelOne::Update.
+	 *
+	 * @param deltaTime The duration of the tick, in seconds.
+	 */
+	void Tick(float deltaTime);
+
+	/**
+	 * @brief Feeds the scripted cursor position and buttons for the current tick to the InputManager.
+	 *
+	 * The cursor sweeps along the bottom of the screen while the shoot button is tapped at a steady rate. While the
+	 * InputManager plays a recording back, the recording wins and the script is ignored.
+	 */
+	void ApplyScriptedInput();
+
+	/**
+	 * @brief Spawns a new wave of enemies in a grid formation.
+	 */
+	void SpawnWave();
+
+private:
+	// Gameplay
+	Spaceship m_Spaceship;        ///< The player's spaceship
+	EnemyStore m_Enemies;         ///< Every enemy of the current wave and their projectiles
+	SpatialHashGrid m_EnemyGrid;  ///< Broadphase grid rebuilt from the enemies every tick
+
+	// Script
+	int m_EnemyCount;             ///< Number of enemies in every wave
+	float m_ElapsedTime;          ///< Simulated time, drives the cursor sweep
+
+	// Statistics
+	PhaseTimings m_Timings;       ///< Time spent in each phase
+	int m_Tick;                   ///< Number of ticks simulated
+	int m_Waves;                  ///< Number of waves spawned
+	int m_PlayerHits;             ///< Number of enemy projectiles that hit the spaceship
+};
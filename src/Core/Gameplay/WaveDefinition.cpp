@@ -0,0 +1,189 @@
+#include "stdafx.h"
+#include "WaveDefinition.h"
+#include "Core/Managers/AssetPack.h"
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+	/**
+	 * @brief Reads an "x,y" pair.
+	 */
+	bool ParseVector(const std::string& text, Vector2f& outVector)
+	{
+		const std::size_t comma = text.find(',');
+		if (comma == std::string::npos)
+		{
+			return false;
+		}
+
+		try
+		{
+			outVector.x = std::stof(text.substr(0, comma));
+			outVector.y = std::stof(text.substr(comma + 1));
+		}
+		catch (const std::exception&)
+		{
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Reads a number, rejecting trailing characters.
+	 */
+	template <typename T>
+	bool ParseNumber(const std::string& text, T& outValue)
+	{
+		std::istringstream stream(text);
+		stream >> outValue;
+		return !stream.fail() && stream.eof();
+	}
+
+	/**
+	 * @brief Applies one key=value pair to a wave.
+	 */
+	bool ApplyField(const std::string& key, const std::string& value, WaveDefinition& outWave)
+	{
+		if (key == "count")
+		{
+			return ParseNumber(value, outWave.count);
+		}
+		if (key == "rate")
+		{
+			return ParseNumber(value, outWave.spawnRate);
+		}
+		if (key == "columns")
+		{
+			return ParseNumber(value, outWave.columns);
+		}
+		if (key == "spacing")
+		{
+			return ParseVector(value, outWave.spacing);
+		}
+		if (key == "origin")
+		{
+			return ParseVector(value, outWave.origin);
+		}
+		if (key == "enemy")
+		{
+			static const std::unordered_map<std::string, EnemyType> types =
+			{
+				{ "pig", EnemyType::PIG },
+				{ "cow", EnemyType::COW }
+			};
+			auto it = types.find(value);
+			if (it == types.end())
+			{
+				return false;
+			}
+			outWave.enemyType = it->second;
+			return true;
+		}
+		if (key == "formation")
+		{
+			static const std::unordered_map<std::string, WaveFormation> formations =
+			{
+				{ "grid", WaveFormation::GRID },
+				{ "v", WaveFormation::V_SHAPE }
+			};
+			auto it = formations.find(value);
+			if (it == formations.end())
+			{
+				return false;
+			}
+			outWave.formation = it->second;
+			return true;
+		}
+		if (key == "difficulty")
+		{
+			static const std::unordered_map<std::string, DifficultyLevel> levels =
+			{
+				{ "very_easy", DifficultyLevel::VERY_EASY },
+				{ "easy", DifficultyLevel::EASY },
+				{ "normal", DifficultyLevel::NORMAL },
+				{ "hard", DifficultyLevel::HARD },
+				{ "very_hard", DifficultyLevel::VERY_HARD },
+				{ "insane", DifficultyLevel::INSANE }
+			};
+			auto it = levels.find(value);
+			if (it == levels.end())
+			{
+				return false;
+			}
+			outWave.difficulty = it->second;
+			return true;
+		}
+
+		// Unknown key
+		return false;
+	}
+}
+
+bool WaveLoader::LoadFromFile(const std::string& fileName, std::vector<WaveDefinition>& outWaves)
+{
+	// Read the packed copy when there is one, the file is a few lines so parsing a copy of it costs nothing
+	const AssetView view = AssetPack::Get().Find(fileName);
+	std::istringstream packedFile(view.IsValid() ? std::string(static_cast<const char*>(view.data), view.size) : std::string());
+	std::ifstream looseFile;
+	if (!view.IsValid())
+	{
+		looseFile.open(fileName);
+	}
+
+	std::istream& file = view.IsValid() ? static_cast<std::istream&>(packedFile) : looseFile;
+	if (!file)
+	{
+		Log::Print("Failed to open wave file: " + fileName, LogLevel::ERROR_);
+		return false;
+	}
+
+	outWaves.clear();
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(file, line))
+	{
+		++lineNumber;
+
+		// Blank lines and comments are not waves, but not errors either
+		const std::size_t first = line.find_first_not_of(" \t\r");
+		if (first == std::string::npos || line[first] == '#')
+		{
+			continue;
+		}
+
+		WaveDefinition wave;
+		if (!ParseLine(line, wave))
+		{
+			Log::Print("Invalid wave in " + fileName + ", line", lineNumber, LogLevel::WARNING);
+			continue;
+		}
+		outWaves.push_back(wave);
+	}
+
+	return !outWaves.empty();
+}
+
+bool WaveLoader::ParseLine(const std::string& line, WaveDefinition& outWave)
+{
+	std::istringstream stream(line);
+	std::string field;
+	bool hasField = false;
+	while (stream >> field)
+	{
+		if (field[0] == '#')
+		{
+			break; // The rest of the line is a comment
+		}
+
+		const std::size_t equals = field.find('=');
+		if (equals == std::string::npos || !ApplyField(field.substr(0, equals), field.substr(equals + 1), outWave))
+		{
+			return false;
+		}
+		hasField = true;
+	}
+
+	// A grid needs at least one column, every wave at least one enemy
+	return hasField && outWave.count > 0 && outWave.columns > 0 && outWave.spawnRate >= 0.0f;
+}
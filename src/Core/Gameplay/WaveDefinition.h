@@ -0,0 +1,68 @@
+/*!
+ * \file WaveDefinition.h
+ *
+ * \brief Contains the WaveFormation enum, the WaveDefinition struct and the WaveLoader functions, which describe the
+ * enemy waves of a level as data.
+ *
+ * Waves used to be hard-coded calls to GameplayUtility::EnemySpawner. They now come from a text file with one wave
+ * per line, written as key=value pairs, so levels can be tuned without rebuilding:
+ *
+ *     count=45 enemy=pig formation=grid difficulty=very_easy columns=15 spacing=130,150
+ *
+ * Lines starting with '#' and blank lines are ignored. See WaveDefinition for the keys and their defaults.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "Entities/EnemyStore.h"
+
+/**
+ * @enum WaveFormation
+ * @brief The shapes a wave's enemies are laid out in.
+ */
+enum class WaveFormation
+{
+	GRID,    ///< Rows of a fixed number of columns, filled left to right from the origin (the top-left corner)
+	V_SHAPE  ///< Two arms spreading down from the origin (the tip), one enemy on each side per row
+};
+
+/**
+ * @struct WaveDefinition
+ * @brief Everything needed to spawn one wave. The file key of each field is given in brackets.
+ */
+struct WaveDefinition
+{
+	EnemyType enemyType = EnemyType::PIG;                 ///< [enemy] pig or cow
+	int count = 0;                                        ///< [count] Number of enemies, required
+	WaveFormation formation = WaveFormation::GRID;        ///< [formation] grid or v
+	DifficultyLevel difficulty = DifficultyLevel::NORMAL; ///< [difficulty] very_easy, easy, normal, hard, very_hard or insane
+	float spawnRate = 0.0f;                               ///< [rate] Enemies per second, 0 spawns as fast as the budget allows
+	int columns = 15;                                     ///< [columns] Enemies per row of a grid
+	Vector2f spacing = Vector2f(130.0f, 150.0f);          ///< [spacing] Distance between neighbouring enemies, as x,y
+	Vector2f origin;                                      ///< [origin] Where the formation starts, as x,y
+};
+
+namespace WaveLoader
+{
+	/**
+	 * @brief Reads the waves of a level from a wave file.
+	 *
+	 * Invalid lines are reported with their line number and skipped, the valid waves are still returned.
+	 *
+	 * @param fileName The wave file to read.
+	 * @param outWaves Receives the waves, in file order.
+	 * @return True if the file could be read and holds at least one valid wave.
+	 */
+	bool LoadFromFile(const std::string& fileName, std::vector<WaveDefinition>& outWaves);
+
+	/**
+	 * @brief Parses one line of a wave file.
+	 *
+	 * @param line The line, without its line break.
+	 * @param outWave Receives the wave; keys missing from the line keep their default value.
+	 * @return True if the line holds a valid wave, false if it is invalid, blank or a comment.
+	 */
+	bool ParseLine(const std::string& line, WaveDefinition& outWave);
+}
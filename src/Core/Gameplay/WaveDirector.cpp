@@ -0,0 +1,132 @@
+#include "stdafx.h"
+#include "WaveDirector.h"
+
+WaveDirector::WaveDirector(std::size_t spawnBudget /*= DEFAULT_SPAWN_BUDGET*/)
+	: m_WaveMemory(MemoryTag::SCENE)
+	, m_SpawnBudget(std::max<std::size_t>(1, spawnBudget))
+	, m_WaveIndex(SIZE_MAX)
+	, m_SpawnedCount(0)
+	, m_SpawnCredit(0.0f)
+	, m_BreakTimeLeft(0.0f)
+	, m_HasWaveStarted(false)
+	, m_IsFinished(false)
+{
+}
+
+void WaveDirector::SetWaves(const std::vector<WaveDefinition>& waves)
+{
+	m_Waves = waves;
+	m_WaveMemory.Resize(m_Waves.capacity() * sizeof(WaveDefinition));
+}
+
+void WaveDirector::Start(EnemyStore& enemies)
+{
+	m_WaveIndex = SIZE_MAX;
+	m_SpawnedCount = 0;
+	m_SpawnCredit = 0.0f;
+	m_BreakTimeLeft = 0.0f;
+	m_HasWaveStarted = false;
+	m_IsFinished = m_Waves.empty();
+
+	// Grow the store once now rather than at the start of a big wave
+	int largestWave = 0;
+	for (const WaveDefinition& wave : m_Waves)
+	{
+		largestWave = std::max(largestWave, wave.count);
+	}
+	enemies.Reserve(static_cast<std::size_t>(largestWave));
+}
+
+void WaveDirector::Update(float deltaTime, EnemyStore& enemies)
+{
+	m_HasWaveStarted = false;
+	if (m_IsFinished)
+	{
+		return;
+	}
+
+	if (IsSpawning())
+	{
+		SpawnEnemies(deltaTime, enemies);
+		return;
+	}
+
+	// The current wave is fully spawned; wait until it is cleared
+	if (!enemies.IsEmpty())
+	{
+		return;
+	}
+
+	const std::size_t nextIndex = (m_WaveIndex == SIZE_MAX) ? 0 : m_WaveIndex + 1;
+	if (nextIndex >= m_Waves.size())
+	{
+		m_IsFinished = true;
+		return;
+	}
+
+	// No break before the first wave, the level just started
+	if (nextIndex > 0)
+	{
+		m_BreakTimeLeft -= deltaTime;
+		if (m_BreakTimeLeft > 0.0f)
+		{
+			return;
+		}
+	}
+
+	BeginWave(nextIndex);
+	SpawnEnemies(deltaTime, enemies);
+}
+
+void WaveDirector::BeginWave(std::size_t index)
+{
+	m_WaveIndex = index;
+	m_SpawnedCount = 0;
+	m_SpawnCredit = 0.0f;
+	m_BreakTimeLeft = WAVE_BREAK;
+	m_HasWaveStarted = true;
+}
+
+void WaveDirector::SpawnEnemies(float deltaTime, EnemyStore& enemies)
+{
+	MOO_PROFILE_FUNCTION();
+	const WaveDefinition& wave = m_Waves[m_WaveIndex];
+	const std::size_t remaining = static_cast<std::size_t>(wave.count - m_SpawnedCount);
+
+	// A rate of 0 means as fast as the budget allows; unspent credit is capped so a stall cannot cause a burst
+	std::size_t spawnCount = std::min(m_SpawnBudget, remaining);
+	if (wave.spawnRate > 0.0f)
+	{
+		m_SpawnCredit = std::min(m_SpawnCredit + wave.spawnRate * deltaTime, static_cast<float>(m_SpawnBudget));
+		spawnCount = std::min(spawnCount, static_cast<std::size_t>(m_SpawnCredit));
+		m_SpawnCredit -= static_cast<float>(spawnCount);
+	}
+
+	for (std::size_t i = 0; i < spawnCount; ++i)
+	{
+		enemies.Spawn(GetFormationPosition(wave, m_SpawnedCount), wave.difficulty, wave.enemyType);
+		++m_SpawnedCount;
+	}
+}
+
+Vector2f WaveDirector::GetFormationPosition(const WaveDefinition& wave, int index)
+{
+	switch (wave.formation)
+	{
+	case WaveFormation::V_SHAPE:
+	{
+		// Index 0 is the tip, then one enemy left and one right per row
+		const int row = (index + 1) / 2;
+		const float side = (index % 2 == 1) ? -1.0f : 1.0f;
+		return Vector2f(wave.origin.x + side * row * wave.spacing.x, wave.origin.y + row * wave.spacing.y);
+	}
+
+	case WaveFormation::GRID:
+	default:
+	{
+		const int row = index / wave.columns;
+		const int column = index % wave.columns;
+		return Vector2f(wave.origin.x + column * wave.spacing.x, wave.origin.y + row * wave.spacing.y);
+	}
+	}
+}
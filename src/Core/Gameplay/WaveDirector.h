@@ -0,0 +1,132 @@
+/*!
+ * \file WaveDirector.h
+ *
+ * \brief Contains the WaveDirector class, which plays a level's waves and streams their enemies in over many ticks.
+ *
+ * Spawning a whole wave in one tick made every wave transition a spike that grew with the wave size. The director
+ * spawns at most a fixed number of enemies per tick instead, at the rate the wave asks for, and reserves the store
+ * for the largest wave up front so no transition reallocates. The budget is a count rather than a time so that
+ * replays spawn exactly the same enemies on the same ticks.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "WaveDefinition.h"
+
+/**
+ * @class WaveDirector
+ * @brief Spawns a sequence of waves into an EnemyStore, one wave after the previous one was cleared.
+ *
+ * Call Start() when the level begins and Update() once per tick. A new wave begins WAVE_BREAK seconds after the
+ * previous one was fully spawned and every enemy of it is gone; HasWaveStarted() reports that tick, for banners.
+ */
+class WaveDirector
+{
+public:
+	static constexpr std::size_t DEFAULT_SPAWN_BUDGET = 32; ///< Default maximum number of enemies spawned per tick
+	static constexpr float WAVE_BREAK = 1.5f;               ///< Seconds between a cleared wave and the next one
+
+	/**
+	 * @brief Constructs a director without waves.
+	 *
+	 * @param spawnBudget The maximum number of enemies spawned in one tick, whatever the wave's rate.
+	 */
+	explicit WaveDirector(std::size_t spawnBudget = DEFAULT_SPAWN_BUDGET);
+
+	/**
+	 * @brief Replaces the waves to play.
+	 *
+	 * @param waves The waves, in order.
+	 */
+	void SetWaves(const std::vector<WaveDefinition>& waves);
+
+	/**
+	 * @brief Restarts from the first wave, which begins on the next Update().
+	 *
+	 * @param enemies The store the waves spawn into, reserved for the largest wave.
+	 */
+	void Start(EnemyStore& enemies);
+
+	/**
+	 * @brief Advances the current wave by one tick: spawns its next enemies, or begins the next wave once it is over.
+	 *
+	 * @param deltaTime The duration of the tick, in seconds.
+	 * @param enemies The store the waves spawn into.
+	 */
+	void Update(float deltaTime, EnemyStore& enemies);
+
+	// Getters
+
+	/**
+	 * @brief Gets the number of the current wave.
+	 *
+	 * @return The wave number, starting at 1, or 0 before the first wave began.
+	 */
+	inline int GetWaveNumber() const { return static_cast<int>(m_WaveIndex) + 1; }
+
+	/**
+	 * @brief Gets the number of waves to play.
+	 *
+	 * @return The wave count.
+	 */
+	inline std::size_t GetWaveCount() const { return m_Waves.size(); }
+
+	/**
+	 * @brief Checks whether a wave began during the last Update().
+	 *
+	 * @return True on the tick a wave began.
+	 */
+	inline bool HasWaveStarted() const { return m_HasWaveStarted; }
+
+	/**
+	 * @brief Checks whether enemies of the current wave are still waiting to be spawned.
+	 *
+	 * @return True while the current wave is streaming in.
+	 */
+	inline bool IsSpawning() const { return m_WaveIndex < m_Waves.size() && m_SpawnedCount < m_Waves[m_WaveIndex].count; }
+
+	/**
+	 * @brief Checks whether every wave was spawned and cleared.
+	 *
+	 * @return True once the level's waves are over.
+	 */
+	inline bool IsFinished() const { return m_IsFinished; }
+
+private:
+	/**
+	 * @brief Makes a wave the current one.
+	 *
+	 * @param index The index of the wave.
+	 */
+	void BeginWave(std::size_t index);
+
+	/**
+	 * @brief Spawns the enemies of the current wave this tick's rate and budget allow.
+	 *
+	 * @param deltaTime The duration of the tick, in seconds.
+	 * @param enemies The store to spawn into.
+	 */
+	void SpawnEnemies(float deltaTime, EnemyStore& enemies);
+
+	/**
+	 * @brief Gets where an enemy of a wave stands in its formation.
+	 *
+	 * @param wave The wave.
+	 * @param index The index of the enemy within the wave.
+	 * @return The spawn position of the enemy.
+	 */
+	static Vector2f GetFormationPosition(const WaveDefinition& wave, int index);
+
+private:
+	std::vector<WaveDefinition> m_Waves; ///< The waves of the level, in order
+	TrackedMemory m_WaveMemory;          ///< Capacity of m_Waves, reported as scene
+	std::size_t m_SpawnBudget;           ///< Maximum number of enemies spawned per tick
+	std::size_t m_WaveIndex;             ///< The current wave, SIZE_MAX before the first one
+	int m_SpawnedCount;                  ///< Enemies of the current wave spawned so far
+	float m_SpawnCredit;                 ///< Enemies the wave's rate allows to spawn, carried between ticks
+	float m_BreakTimeLeft;               ///< Seconds until the next wave begins, once the current one is over
+	bool m_HasWaveStarted;               ///< A wave began during the last Update()
+	bool m_IsFinished;                   ///< Every wave was spawned and cleared
+};
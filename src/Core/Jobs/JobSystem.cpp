@@ -0,0 +1,229 @@
+#include "stdafx.h"
+#include "JobSystem.h"
+#include "Core/Memory/AllocationCounter.h"
+
+// ********************* JOB SYSTEM CONSTANTS ********************
+constexpr unsigned int MAX_JOB_WORKERS = 15;     // Beyond this, per-frame loops are too short to split further
+constexpr int IDLE_SPINS_BEFORE_SLEEP = 2000;    // Failed steal attempts before a worker sleeps; frames queue jobs in bursts
+// ****************************************************
+
+namespace
+{
+	/// Index of the calling thread's deque: 0 for the main thread (and any thread that is not a worker)
+	thread_local std::size_t t_QueueIndex = 0;
+}
+
+JobSystem::JobSystem()
+	: m_QueuedJobs(0)
+	, m_IsStopping(false)
+{
+	// Leave one core to the main thread, which runs jobs itself while it waits
+	const unsigned int cores = std::thread::hardware_concurrency();
+	StartWorkers(std::min(cores > 1 ? cores - 1 : 0u, MAX_JOB_WORKERS));
+}
+
+JobSystem::~JobSystem()
+{
+	StopWorkers();
+}
+
+void JobSystem::SetWorkerCount(unsigned int workerCount)
+{
+	StopWorkers();
+	StartWorkers(workerCount);
+}
+
+void JobSystem::Run(const Job& job)
+{
+	job.counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+	// Nobody to hand the job to, or no room left: run it right away
+	if (m_Workers.empty() || !Push(job))
+	{
+		Execute(job);
+		return;
+	}
+
+	WakeWorkers();
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+	MOO_PROFILE_SCOPE("JobSystem::Wait");
+
+	// Help instead of blocking: the jobs being waited for may well be sitting in this thread's own deque
+	while (!counter.IsDone())
+	{
+		Job job;
+		if (FindJob(job))
+		{
+			Execute(job);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::Schedule(std::size_t count, std::size_t grainSize, JobFunction function, void* data, JobCounter& counter)
+{
+	grainSize = std::max<std::size_t>(grainSize, 1);
+
+	// A single chunk is not worth a trip through the deques
+	if (m_Workers.empty() || count <= grainSize)
+	{
+		if (count > 0)
+		{
+			function(data, 0, count);
+		}
+		return;
+	}
+
+	for (std::size_t begin = 0; begin < count; begin += grainSize)
+	{
+		const Job job{ function, data, begin, std::min(begin + grainSize, count), &counter };
+		counter.pending.fetch_add(1, std::memory_order_relaxed);
+		if (!Push(job))
+		{
+			Execute(job);
+		}
+	}
+
+	WakeWorkers();
+}
+
+bool JobSystem::Push(const Job& job)
+{
+	JobQueue& queue = *m_Queues[t_QueueIndex];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.bottom - queue.top == QUEUE_CAPACITY)
+		{
+			return false;
+		}
+
+		queue.jobs[queue.bottom % QUEUE_CAPACITY] = job;
+		++queue.bottom;
+	}
+
+	m_QueuedJobs.fetch_add(1, std::memory_order_release);
+	return true;
+}
+
+bool JobSystem::FindJob(Job& outJob)
+{
+	// Own deque first, newest job first
+	{
+		JobQueue& queue = *m_Queues[t_QueueIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.bottom != queue.top)
+		{
+			--queue.bottom;
+			outJob = queue.jobs[queue.bottom % QUEUE_CAPACITY];
+			m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	// Then steal the oldest job of the next deques, starting after our own so thieves spread over the victims
+	const std::size_t queueCount = m_Queues.size();
+	for (std::size_t offset = 1; offset < queueCount; ++offset)
+	{
+		JobQueue& victim = *m_Queues[(t_QueueIndex + offset) % queueCount];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (victim.bottom != victim.top)
+		{
+			outJob = victim.jobs[victim.top % QUEUE_CAPACITY];
+			++victim.top;
+			m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void JobSystem::Execute(const Job& job)
+{
+	job.function(job.data, job.begin, job.end);
+
+	// Release: whoever sees the counter reach zero also sees everything the job wrote
+	job.counter->pending.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::WakeWorkers()
+{
+	// Taking the lock orders the wake-up after a worker's last look at m_QueuedJobs, so none sleeps through it
+	{
+		std::lock_guard<std::mutex> lock(m_SleepMutex);
+	}
+	m_WakeUp.notify_all();
+}
+
+void JobSystem::StartWorkers(unsigned int workerCount)
+{
+	m_IsStopping = false;
+
+	m_Queues.clear();
+	for (unsigned int i = 0; i <= workerCount; ++i)
+	{
+		m_Queues.push_back(std::make_unique<JobQueue>());
+	}
+
+	m_Workers.reserve(workerCount);
+	for (unsigned int i = 0; i < workerCount; ++i)
+	{
+		m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+	}
+}
+
+void JobSystem::StopWorkers()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_SleepMutex);
+		m_IsStopping = true;
+	}
+	m_WakeUp.notify_all();
+
+	for (std::thread& worker : m_Workers)
+	{
+		worker.join();
+	}
+	m_Workers.clear();
+}
+
+void JobSystem::WorkerLoop(std::size_t queueIndex)
+{
+	MOO_PROFILE_THREAD("JobWorker");
+	t_QueueIndex = queueIndex;
+
+	int idleSpins = 0;
+	while (true)
+	{
+		Job job;
+		if (FindJob(job))
+		{
+			// Jobs are the frame's work split over threads, their allocations belong to the frame
+			AllocationCounter::Scope countAllocations;
+			Execute(job);
+			idleSpins = 0;
+			continue;
+		}
+
+		// Jobs come in bursts a few times per tick: spin a little before paying for a sleep and a wake-up
+		if (++idleSpins < IDLE_SPINS_BEFORE_SLEEP)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_SleepMutex);
+		m_WakeUp.wait(lock, [this]() { return m_IsStopping || m_QueuedJobs.load(std::memory_order_acquire) > 0; });
+		if (m_IsStopping)
+		{
+			return;
+		}
+		idleSpins = 0;
+	}
+}
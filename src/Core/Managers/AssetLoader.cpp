@@ -0,0 +1,139 @@
+#include "stdafx.h"
+#include "AssetLoader.h"
+#include "AssetPack.h"
+
+// ********************* ASSET LOADER CONSTANTS ********************
+constexpr unsigned int MAX_LOADER_WORKERS = 4; // Decoding is mostly disk bound, more threads stop helping
+// ****************************************************
+
+AssetLoader::AssetLoader(unsigned int workerCount /*= 0*/)
+	: m_WorkerCount(workerCount)
+	, m_PendingCount(0)
+	, m_IsStopping(false)
+{
+	if (m_WorkerCount == 0)
+	{
+		// Leave one core to the main thread, which keeps drawing the loading screen
+		const unsigned int cores = std::thread::hardware_concurrency();
+		m_WorkerCount = std::clamp(cores > 1 ? cores - 1 : 1u, 1u, MAX_LOADER_WORKERS);
+	}
+}
+
+AssetLoader::~AssetLoader()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_IsStopping = true;
+		m_Requests.clear();
+	}
+
+	m_WakeUp.notify_all();
+	for (std::thread& worker : m_Workers)
+	{
+		worker.join();
+	}
+}
+
+void AssetLoader::Request(AssetType type, const std::string& fileName)
+{
+	StartWorkers();
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Requests.emplace_back(type, fileName);
+		++m_PendingCount;
+	}
+
+	m_WakeUp.notify_one();
+}
+
+std::size_t AssetLoader::PopLoaded(std::vector<LoadedAsset>& outAssets, std::size_t maxAssets)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+	std::size_t popped = 0;
+	while (!m_Loaded.empty() && popped < maxAssets)
+	{
+		outAssets.push_back(std::move(m_Loaded.front()));
+		m_Loaded.pop_front();
+		++popped;
+	}
+
+	m_PendingCount -= popped;
+	return popped;
+}
+
+std::size_t AssetLoader::GetPendingCount() const
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_PendingCount;
+}
+
+void AssetLoader::StartWorkers()
+{
+	// Only the main thread requests assets, so no lock is needed around the worker list
+	if (!m_Workers.empty())
+	{
+		return;
+	}
+
+	m_Workers.reserve(m_WorkerCount);
+	for (unsigned int i = 0; i < m_WorkerCount; ++i)
+	{
+		m_Workers.emplace_back(&AssetLoader::WorkerLoop, this);
+	}
+}
+
+void AssetLoader::WorkerLoop()
+{
+	MOO_PROFILE_THREAD("AssetLoader");
+
+	while (true)
+	{
+		std::pair<AssetType, std::string> request;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_WakeUp.wait(lock, [this]() { return m_IsStopping || !m_Requests.empty(); });
+			if (m_IsStopping)
+			{
+				return;
+			}
+
+			request = std::move(m_Requests.front());
+			m_Requests.pop_front();
+		}
+
+		// The slow part runs without holding the lock
+		MOO_PROFILE_SCOPE("DecodeAsset");
+		LoadedAsset asset = Decode(request.first, request.second);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Loaded.push_back(std::move(asset));
+	}
+}
+
+LoadedAsset AssetLoader::Decode(AssetType type, const std::string& fileName)
+{
+	LoadedAsset asset;
+	asset.type = type;
+	asset.fileName = fileName;
+
+	switch (type)
+	{
+	case AssetType::IMAGE:
+		asset.succeeded = AssetPack::Get().Load(asset.image, fileName);
+		break;
+
+	case AssetType::FONT:
+		asset.font = std::make_shared<sf::Font>();
+		asset.succeeded = AssetPack::Get().Load(*asset.font, fileName);
+		break;
+
+	case AssetType::SOUND_BUFFER:
+		asset.soundBuffer = std::make_shared<sf::SoundBuffer>();
+		asset.succeeded = AssetPack::Get().Load(*asset.soundBuffer, fileName);
+		break;
+	}
+
+	return asset;
+}
@@ -0,0 +1,126 @@
+/*!
+ * \file AssetLoader.h
+ *
+ * \brief Contains the AssetType enum, the LoadedAsset struct and the AssetLoader class, a small pool of threads that
+ * decode asset files in the background.
+ *
+ * Reading and decoding files (PNG images, fonts, WAV samples) is the slow part of loading and needs neither the
+ * window nor the GPU, so it runs on worker threads. Creating textures does need a GL context: the render thread owns
+ * the window's, and the main thread uploads through SFML's hidden context, shared with the window's. Images therefore
+ * come back decoded but not uploaded, and the ResourceCache finishes them on the main thread.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @enum AssetType
+ * @brief The kinds of files the AssetLoader can decode.
+ */
+enum class AssetType
+{
+	IMAGE,        ///< Decoded to an sf::Image, uploaded to a texture on the main thread
+	FONT,         ///< Loaded to an sf::Font, ready to use
+	SOUND_BUFFER  ///< Decoded to an sf::SoundBuffer, ready to use
+};
+
+/**
+ * @struct LoadedAsset
+ * @brief The result of one request, handed back to the main thread.
+ *
+ * Only the member matching the type is filled.
+ */
+struct LoadedAsset
+{
+	AssetType type = AssetType::IMAGE;            ///< What was requested
+	std::string fileName;                         ///< The path of the file
+	bool succeeded = false;                       ///< False if the file could not be read or decoded
+	sf::Image image;                              ///< The decoded pixels (IMAGE)
+	std::shared_ptr<sf::Font> font;               ///< The loaded font (FONT)
+	std::shared_ptr<sf::SoundBuffer> soundBuffer; ///< The decoded samples (SOUND_BUFFER)
+};
+
+/**
+ * @class AssetLoader
+ * @brief Decodes files on worker threads and queues the results for the main thread.
+ *
+ * Request() never blocks on disk; the main thread collects finished assets with PopLoaded() whenever it wants, for
+ * example once per frame while a loading screen is shown. The workers are only started by the first request, so a
+ * process that never loads asynchronously (the headless benchmark) never spawns them.
+ */
+class AssetLoader
+{
+public:
+	/**
+	 * @brief Constructs an idle loader.
+	 *
+	 * @param workerCount The number of worker threads to start on the first request; 0 picks one per spare core.
+	 */
+	explicit AssetLoader(unsigned int workerCount = 0);
+
+	/**
+	 * @brief Stops the workers, dropping the requests they have not started yet.
+	 */
+	~AssetLoader();
+
+	// Deleted copy constructor and assignment operator
+	AssetLoader(const AssetLoader&) = delete;
+	AssetLoader& operator=(const AssetLoader&) = delete;
+
+	/**
+	 * @brief Queues a file to be decoded in the background.
+	 *
+	 * @param type What the file should be decoded to.
+	 * @param fileName The path of the file.
+	 */
+	void Request(AssetType type, const std::string& fileName);
+
+	/**
+	 * @brief Moves finished assets to the caller, oldest first.
+	 *
+	 * @param outAssets Receives the finished assets, appended at the end.
+	 * @param maxAssets The maximum number of assets to move.
+	 * @return The number of assets moved.
+	 */
+	std::size_t PopLoaded(std::vector<LoadedAsset>& outAssets, std::size_t maxAssets);
+
+	/**
+	 * @brief Gets the number of requests that have not been popped yet, whether decoding or finished.
+	 *
+	 * @return The pending request count.
+	 */
+	std::size_t GetPendingCount() const;
+
+private:
+	/**
+	 * @brief Starts the worker threads if they are not running yet.
+	 */
+	void StartWorkers();
+
+	/**
+	 * @brief Body of every worker: decodes requests until the loader is destroyed.
+	 */
+	void WorkerLoop();
+
+	/**
+	 * @brief Reads and decodes one file.
+	 *
+	 * @param type What the file should be decoded to.
+	 * @param fileName The path of the file.
+	 * @return The decoded asset, with succeeded set to false on failure.
+	 */
+	static LoadedAsset Decode(AssetType type, const std::string& fileName);
+
+private:
+	unsigned int m_WorkerCount;                                  ///< Number of workers started by the first request
+	std::vector<std::thread> m_Workers;                          ///< The worker threads, empty until the first request
+
+	mutable std::mutex m_Mutex;                                  ///< Guards every member below
+	std::condition_variable m_WakeUp;                            ///< Signalled when a request arrives or the loader stops
+	std::deque<std::pair<AssetType, std::string>> m_Requests;    ///< Requests waiting for a worker
+	std::deque<LoadedAsset> m_Loaded;                            ///< Finished assets waiting for PopLoaded()
+	std::size_t m_PendingCount;                                  ///< Requests not popped yet
+	bool m_IsStopping;                                           ///< Set by the destructor to release the workers
+};
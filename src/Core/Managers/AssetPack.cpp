@@ -0,0 +1,290 @@
+#include "stdafx.h"
+#include "AssetPack.h"
+#include "BakedTexture.h"
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(AssetPackHeader) == 16 && sizeof(AssetPackEntry) == 24, "The pack layout must not depend on the compiler");
+
+AssetPack::AssetPack()
+	: m_Data(nullptr)
+	, m_Size(0)
+	, m_Entries(nullptr)
+	, m_EntryCount(0)
+	, m_Paths(nullptr)
+#ifdef _WIN32
+	, m_FileHandle(nullptr)
+	, m_MappingHandle(nullptr)
+#endif
+{
+}
+
+AssetPack::~AssetPack()
+{
+	Close();
+}
+
+bool AssetPack::Open(const std::string& fileName)
+{
+	Close();
+	if (!Map(fileName))
+	{
+		return false;
+	}
+
+	if (!ValidateIndex())
+	{
+		Log::Print("Invalid asset pack, loading loose files instead", fileName, LogLevel::ERROR_);
+		Close();
+		return false;
+	}
+
+	Log::Print("Asset pack opened, files", m_EntryCount);
+	return true;
+}
+
+void AssetPack::Close()
+{
+#ifdef _WIN32
+	if (m_Data != nullptr)
+	{
+		UnmapViewOfFile(m_Data);
+	}
+	if (m_MappingHandle != nullptr)
+	{
+		CloseHandle(m_MappingHandle);
+	}
+	if (m_FileHandle != nullptr)
+	{
+		CloseHandle(m_FileHandle);
+	}
+	m_MappingHandle = nullptr;
+	m_FileHandle = nullptr;
+#else
+	if (m_Data != nullptr)
+	{
+		munmap(const_cast<std::byte*>(m_Data), m_Size);
+	}
+#endif
+
+	m_Data = nullptr;
+	m_Size = 0;
+	m_Entries = nullptr;
+	m_EntryCount = 0;
+	m_Paths = nullptr;
+}
+
+AssetView AssetPack::Find(std::string_view fileName) const
+{
+	AssetView view;
+	if (m_Data == nullptr)
+	{
+		return view;
+	}
+
+	// The index is sorted, so a lookup is a binary search over the mapping itself
+	const AssetPackEntry* end = m_Entries + m_EntryCount;
+	const AssetPackEntry* entry = std::lower_bound(m_Entries, end, fileName,
+		[this](const AssetPackEntry& candidate, std::string_view path) { return ComparePaths(GetPath(candidate), path) < 0; });
+
+	if (entry != end && ComparePaths(GetPath(*entry), fileName) == 0)
+	{
+		view.data = m_Data + entry->dataOffset;
+		view.size = static_cast<std::size_t>(entry->dataSize);
+	}
+	return view;
+}
+
+bool AssetPack::Load(sf::Image& outImage, const std::string& fileName) const
+{
+	sf::Vector2u size;
+	const sf::Uint8* pixels = nullptr;
+	if (FindBaked(fileName, size, pixels))
+	{
+		outImage.create(size.x, size.y, pixels);
+		return true;
+	}
+	return LoadEncoded(outImage, fileName);
+}
+
+bool AssetPack::Load(sf::Texture& outTexture, const std::string& fileName) const
+{
+	sf::Vector2u size;
+	const sf::Uint8* pixels = nullptr;
+	if (FindBaked(fileName, size, pixels))
+	{
+		// No decoding and no intermediate sf::Image, the pixels go from the mapping to the driver
+		MOO_PROFILE_SCOPE("LoadBakedTexture");
+		if (!outTexture.create(size.x, size.y))
+		{
+			return false;
+		}
+		outTexture.update(pixels);
+		return true;
+	}
+
+	// Same cost as sf::Texture::loadFromFile(): decode into an sf::Image, then create and update the texture
+	MOO_PROFILE_SCOPE("LoadEncodedTexture");
+	return LoadEncoded(outTexture, fileName);
+}
+
+bool AssetPack::OpenMusic(sf::Music& outMusic, const std::string& fileName) const
+{
+	// The music streams from the mapping while it plays, which is why the pack stays mapped until exit
+	const AssetView view = Find(fileName);
+	return view.IsValid() ? outMusic.openFromMemory(view.data, view.size) : outMusic.openFromFile(fileName);
+}
+
+int AssetPack::ComparePaths(std::string_view left, std::string_view right)
+{
+	auto normalize = [](char character)
+		{
+			if (character == '\\')
+			{
+				return '/';
+			}
+			return (character >= 'A' && character <= 'Z') ? static_cast<char>(character - 'A' + 'a') : character;
+		};
+
+	const std::size_t length = std::min(left.size(), right.size());
+	for (std::size_t i = 0; i < length; ++i)
+	{
+		const unsigned char a = static_cast<unsigned char>(normalize(left[i]));
+		const unsigned char b = static_cast<unsigned char>(normalize(right[i]));
+		if (a != b)
+		{
+			return (a < b) ? -1 : 1;
+		}
+	}
+
+	if (left.size() == right.size())
+	{
+		return 0;
+	}
+	return (left.size() < right.size()) ? -1 : 1;
+}
+
+bool AssetPack::FindBaked(const std::string& fileName, sf::Vector2u& outSize, const sf::Uint8*& outPixels) const
+{
+	if (m_Data == nullptr)
+	{
+		return false;
+	}
+
+	const std::string bakedPath = BakedTexture::GetBakedPath(fileName);
+	const AssetView view = Find(bakedPath);
+	if (!view.IsValid())
+	{
+		return false;
+	}
+
+	if (!BakedTexture::Decode(view, outSize, outPixels))
+	{
+		Log::Print("Invalid baked texture, decoding the image instead", bakedPath, LogLevel::ERROR_);
+		return false;
+	}
+	return true;
+}
+
+bool AssetPack::Map(const std::string& fileName)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	m_FileHandle = file;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		Close();
+		return false;
+	}
+
+	m_MappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (m_MappingHandle == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	m_Data = static_cast<const std::byte*>(MapViewOfFile(m_MappingHandle, FILE_MAP_READ, 0, 0, 0));
+	m_Size = static_cast<std::size_t>(size.QuadPart);
+#else
+	const int file = open(fileName.c_str(), O_RDONLY);
+	if (file < 0)
+	{
+		return false;
+	}
+
+	struct stat status;
+	void* mapping = MAP_FAILED;
+	if (fstat(file, &status) == 0 && status.st_size > 0)
+	{
+		mapping = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	}
+
+	// The mapping keeps the file alive, the descriptor is not needed anymore
+	close(file);
+	if (mapping == MAP_FAILED)
+	{
+		return false;
+	}
+
+	m_Data = static_cast<const std::byte*>(mapping);
+	m_Size = static_cast<std::size_t>(status.st_size);
+#endif
+
+	if (m_Data == nullptr)
+	{
+		Close();
+		return false;
+	}
+	return true;
+}
+
+bool AssetPack::ValidateIndex()
+{
+	if (m_Size < sizeof(AssetPackHeader))
+	{
+		return false;
+	}
+
+	AssetPackHeader header;
+	std::memcpy(&header, m_Data, sizeof(header));
+	if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION)
+	{
+		return false;
+	}
+
+	const std::size_t indexEnd = sizeof(AssetPackHeader) + static_cast<std::size_t>(header.entryCount) * sizeof(AssetPackEntry);
+	if (indexEnd + header.pathBytes > m_Size)
+	{
+		return false;
+	}
+
+	// The header is 16 bytes, so the entries that follow it are aligned for direct access
+	m_Entries = reinterpret_cast<const AssetPackEntry*>(m_Data + sizeof(AssetPackHeader));
+	m_EntryCount = header.entryCount;
+	m_Paths = reinterpret_cast<const char*>(m_Data + indexEnd);
+
+	for (std::size_t i = 0; i < m_EntryCount; ++i)
+	{
+		const AssetPackEntry& entry = m_Entries[i];
+		const bool isPathInside = static_cast<std::uint64_t>(entry.pathOffset) + entry.pathLength <= header.pathBytes;
+		const bool isDataInside = entry.dataOffset <= m_Size && entry.dataSize <= m_Size - entry.dataOffset;
+		if (!isPathInside || !isDataInside)
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,252 @@
+/*!
+ * \file AssetPack.h
+ *
+ * \brief Contains the AssetPack singleton, which memory-maps the game's packed assets and hands them to SFML without
+ * copying them.
+ *
+ * Loose files meant one open, one read and one copy per asset, spread over a directory tree. The PackBuilder tool
+ * concatenates every file under resources/ into one archive with a sorted index in front; at runtime the archive is
+ * mapped once, lookups binary-search the index in place, and the loadFromMemory() functions of SFML read straight
+ * from the mapping. Images the builder baked (see BakedTexture.h) skip decoding entirely. Assets missing from the
+ * pack, or every asset when there is no pack, still load from disk.
+ *
+ * Layout of a pack, all integers little-endian:
+ * - AssetPackHeader
+ * - entryCount AssetPackEntry, sorted with ComparePaths()
+ * - the paths, back to back, without terminators
+ * - the file contents, each aligned to DATA_ALIGNMENT bytes
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @struct AssetPackHeader
+ * @brief The first bytes of a pack.
+ */
+struct AssetPackHeader
+{
+	char magic[4];            ///< "MOOP"
+	std::uint32_t version;    ///< AssetPack::VERSION
+	std::uint32_t entryCount; ///< Number of AssetPackEntry following the header
+	std::uint32_t pathBytes;  ///< Size of the path block following the entries
+};
+
+/**
+ * @struct AssetPackEntry
+ * @brief Where one file lives in a pack.
+ */
+struct AssetPackEntry
+{
+	std::uint64_t dataOffset; ///< Offset of the contents from the start of the pack
+	std::uint64_t dataSize;   ///< Size of the contents, in bytes
+	std::uint32_t pathOffset; ///< Offset of the path in the path block
+	std::uint32_t pathLength; ///< Length of the path, in characters
+};
+
+/**
+ * @struct AssetView
+ * @brief The contents of a packed file, pointing into the mapping.
+ */
+struct AssetView
+{
+	const void* data = nullptr; ///< First byte of the contents, nullptr if the file is not packed
+	std::size_t size = 0;       ///< Size of the contents, in bytes
+
+	/**
+	 * @brief Checks whether the file was found in the pack.
+	 *
+	 * @return True if data points to its contents.
+	 */
+	inline bool IsValid() const { return data != nullptr; }
+};
+
+/**
+ * @class AssetPack
+ * @brief Read-only, memory-mapped view of a pack built by the PackBuilder tool.
+ *
+ * GameInstance opens the pack before the first asset is requested and it stays mapped until exit, so views, fonts
+ * and music streams reading from it never dangle. Once open, the pack is only read, from any thread.
+ */
+class AssetPack
+{
+public:
+	static constexpr char MAGIC[4] = { 'M', 'O', 'O', 'P' }; ///< First bytes of every pack
+	static constexpr std::uint32_t VERSION = 1;              ///< Version written by the builder and required by Open()
+	static constexpr std::size_t DATA_ALIGNMENT = 16;        ///< Alignment of every file's contents in the pack
+
+	/**
+	 * @brief Retrieves the singleton instance of the AssetPack.
+	 *
+	 * @return Reference to the global AssetPack instance.
+	 */
+	static AssetPack& Get()
+	{
+		static AssetPack instance;
+		return instance;
+	}
+
+	/**
+	 * @brief Maps a pack and validates its index, replacing the pack open before.
+	 *
+	 * @param fileName The path of the pack.
+	 * @return True if the pack is usable; otherwise assets keep loading from loose files.
+	 */
+	bool Open(const std::string& fileName);
+
+	/**
+	 * @brief Unmaps the pack. Nothing loaded from it may still be in use.
+	 */
+	void Close();
+
+	/**
+	 * @brief Looks a file up in the pack.
+	 *
+	 * @param fileName The path of the file as written in Strings.h; case and slash direction do not matter.
+	 * @return A view of its contents, invalid if the file is not packed.
+	 */
+	AssetView Find(std::string_view fileName) const;
+
+	/**
+	 * @brief Loads an SFML resource from the pack, or from disk if it is not packed.
+	 *
+	 * @tparam T sf::Font or sf::SoundBuffer; images and textures use the overloads below.
+	 * @param outResource The resource to load.
+	 * @param fileName The path of the file.
+	 * @return True if the resource loaded.
+	 */
+	template <typename T>
+	bool Load(T& outResource, const std::string& fileName) const
+	{
+		return LoadEncoded(outResource, fileName);
+	}
+
+	/**
+	 * @brief Loads an image from its baked copy in the pack, otherwise decodes it from the pack or from disk.
+	 *
+	 * @param outImage The image to load.
+	 * @param fileName The path of the image file.
+	 * @return True if the image loaded.
+	 */
+	bool Load(sf::Image& outImage, const std::string& fileName) const;
+
+	/**
+	 * @brief Uploads a texture from its baked copy in the pack, otherwise decodes it from the pack or from disk.
+	 *
+	 * @param outTexture The texture to load.
+	 * @param fileName The path of the image file.
+	 * @return True if the texture loaded.
+	 */
+	bool Load(sf::Texture& outTexture, const std::string& fileName) const;
+
+	/**
+	 * @brief Opens a music stream on the pack, or on disk if it is not packed.
+	 *
+	 * @param outMusic The music to open.
+	 * @param fileName The path of the file.
+	 * @return True if the music opened.
+	 */
+	bool OpenMusic(sf::Music& outMusic, const std::string& fileName) const;
+
+	/**
+	 * @brief Orders two paths the way the index is sorted: ASCII case-insensitive, '\\' equal to '/'.
+	 *
+	 * @param left The first path.
+	 * @param right The second path.
+	 * @return A negative number, zero or a positive number, like strcmp().
+	 */
+	static int ComparePaths(std::string_view left, std::string_view right);
+
+	// Getters
+
+	/**
+	 * @brief Checks whether a pack is mapped.
+	 *
+	 * @return True if Find() can return packed files.
+	 */
+	inline bool IsOpen() const { return m_Data != nullptr; }
+
+	/**
+	 * @brief Gets the number of files in the pack.
+	 *
+	 * @return The entry count, 0 when no pack is open.
+	 */
+	inline std::size_t GetEntryCount() const { return m_EntryCount; }
+
+private:
+	/**
+	 * @brief Private constructor to enforce singleton pattern.
+	 */
+	AssetPack();
+
+	/**
+	 * @brief Unmaps the pack.
+	 */
+	~AssetPack();
+
+	// Deleted copy constructor and assignment operator
+	AssetPack(const AssetPack&) = delete;
+	AssetPack& operator=(const AssetPack&) = delete;
+
+	/**
+	 * @brief Maps a whole file read-only.
+	 *
+	 * @param fileName The path of the file.
+	 * @return True if m_Data and m_Size now describe the mapping.
+	 */
+	bool Map(const std::string& fileName);
+
+	/**
+	 * @brief Checks that the header and every entry lie within the mapping.
+	 *
+	 * @return True if the pack can be read safely.
+	 */
+	bool ValidateIndex();
+
+	/**
+	 * @brief Loads a resource from its encoded file, in the pack or on disk.
+	 *
+	 * @tparam T sf::Image, sf::Texture, sf::Font or sf::SoundBuffer.
+	 * @param outResource The resource to load.
+	 * @param fileName The path of the file.
+	 * @return True if the resource loaded.
+	 */
+	template <typename T>
+	bool LoadEncoded(T& outResource, const std::string& fileName) const
+	{
+		const AssetView view = Find(fileName);
+		return view.IsValid() ? outResource.loadFromMemory(view.data, view.size) : outResource.loadFromFile(fileName);
+	}
+
+	/**
+	 * @brief Looks up the baked copy of an image.
+	 *
+	 * @param fileName The path of the image file.
+	 * @param outSize Receives the size of the image.
+	 * @param outPixels Receives its RGBA pixels, pointing into the mapping.
+	 * @return True if the pack holds a valid baked copy.
+	 */
+	bool FindBaked(const std::string& fileName, sf::Vector2u& outSize, const sf::Uint8*& outPixels) const;
+
+	/**
+	 * @brief Gets the path of an entry.
+	 *
+	 * @param entry The entry.
+	 * @return The path, pointing into the mapping.
+	 */
+	inline std::string_view GetPath(const AssetPackEntry& entry) const { return std::string_view(m_Paths + entry.pathOffset, entry.pathLength); }
+
+private:
+	const std::byte* m_Data;         ///< First byte of the mapping, nullptr when closed
+	std::size_t m_Size;              ///< Size of the mapping, in bytes
+	const AssetPackEntry* m_Entries; ///< The sorted index, inside the mapping
+	std::size_t m_EntryCount;        ///< Number of entries in the index
+	const char* m_Paths;             ///< The path block, inside the mapping
+
+#ifdef _WIN32
+	void* m_FileHandle;              ///< The open pack file
+	void* m_MappingHandle;           ///< The file mapping object of the pack
+#endif
+};
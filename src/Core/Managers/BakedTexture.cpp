@@ -0,0 +1,56 @@
+#include "stdafx.h"
+#include "BakedTexture.h"
+#include <cstring>
+
+static_assert(sizeof(BakedTextureHeader) == 16, "The baked texture layout must not depend on the compiler");
+
+std::string BakedTexture::GetBakedPath(const std::string& fileName)
+{
+	// Only an extension of the file name itself counts, not a dot in a directory name
+	const std::size_t slash = fileName.find_last_of("/\\");
+	const std::size_t dot = fileName.find_last_of('.');
+	const bool hasExtension = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+	return (hasExtension ? fileName.substr(0, dot) : fileName) + EXTENSION;
+}
+
+void BakedTexture::Encode(const sf::Image& image, std::vector<char>& outData)
+{
+	BakedTextureHeader header = {};
+	std::copy(std::begin(MAGIC), std::end(MAGIC), header.magic);
+	header.version = VERSION;
+	header.width = image.getSize().x;
+	header.height = image.getSize().y;
+
+	const std::size_t pixelBytes = static_cast<std::size_t>(header.width) * header.height * 4;
+	outData.resize(sizeof(header) + pixelBytes);
+	std::memcpy(outData.data(), &header, sizeof(header));
+	if (pixelBytes > 0)
+	{
+		std::memcpy(outData.data() + sizeof(header), image.getPixelsPtr(), pixelBytes);
+	}
+}
+
+bool BakedTexture::Decode(const AssetView& view, sf::Vector2u& outSize, const sf::Uint8*& outPixels)
+{
+	if (!view.IsValid() || view.size < sizeof(BakedTextureHeader))
+	{
+		return false;
+	}
+
+	BakedTextureHeader header;
+	std::memcpy(&header, view.data, sizeof(header));
+	if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION)
+	{
+		return false;
+	}
+
+	const std::uint64_t pixelBytes = static_cast<std::uint64_t>(header.width) * header.height * 4;
+	if (header.width == 0 || header.height == 0 || pixelBytes != view.size - sizeof(header))
+	{
+		return false;
+	}
+
+	outSize = sf::Vector2u(header.width, header.height);
+	outPixels = static_cast<const sf::Uint8*>(view.data) + sizeof(header);
+	return true;
+}
@@ -0,0 +1,66 @@
+/*!
+ * \file BakedTexture.h
+ *
+ * \brief Contains the BakedTexture format, which stores an image as the raw RGBA pixels a texture is uploaded from.
+ *
+ * The full-screen backgrounds are 1920x1080 PNGs of about 2 MB each, and inflating and unfiltering them is most of the
+ * time spent loading them. The PackBuilder tool decodes them once and stores the pixels next to a small header; the
+ * game then creates the texture at the stored size and uploads the pixels straight from the asset pack's mapping.
+ * The pixels are not compressed: a baked background is four times the size of its PNG, so only the large images the
+ * game loads at startup are baked.
+ *
+ * Layout of a baked texture:
+ * - BakedTextureHeader
+ * - width * height RGBA pixels, row by row from the top
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "AssetPack.h"
+
+/**
+ * @struct BakedTextureHeader
+ * @brief The first bytes of a baked texture. Its 16 bytes keep the pixels aligned like the pack's contents.
+ */
+struct BakedTextureHeader
+{
+	char magic[4];         ///< "MOOT"
+	std::uint32_t version; ///< BakedTexture::VERSION
+	std::uint32_t width;   ///< Width of the image, in pixels
+	std::uint32_t height;  ///< Height of the image, in pixels
+};
+
+namespace BakedTexture
+{
+	constexpr char MAGIC[4] = { 'M', 'O', 'O', 'T' }; ///< First bytes of every baked texture
+	constexpr std::uint32_t VERSION = 1;              ///< Version written by Encode() and required by Decode()
+	constexpr const char* EXTENSION = ".mootex";      ///< Replaces the extension of the image it was baked from
+
+	/**
+	 * @brief Gets the path a baked copy of an image is stored under.
+	 *
+	 * @param fileName The path of the image, e.g. "resources/textures/background.png".
+	 * @return The same path with EXTENSION, e.g. "resources/textures/background.mootex".
+	 */
+	std::string GetBakedPath(const std::string& fileName);
+
+	/**
+	 * @brief Bakes an image.
+	 *
+	 * @param image The decoded image.
+	 * @param outData Receives the header and the pixels.
+	 */
+	void Encode(const sf::Image& image, std::vector<char>& outData);
+
+	/**
+	 * @brief Reads a baked texture in place.
+	 *
+	 * @param view The baked texture, usually inside the asset pack.
+	 * @param outSize Receives the size of the image.
+	 * @param outPixels Receives the first pixel, pointing into the view.
+	 * @return False if the view is not a complete baked texture of this version.
+	 */
+	bool Decode(const AssetView& view, sf::Vector2u& outSize, const sf::Uint8*& outPixels);
+}
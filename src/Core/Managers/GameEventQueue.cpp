@@ -0,0 +1,25 @@
+#include "stdafx.h"
+#include "GameEventQueue.h"
+
+GameEventQueue::GameEventQueue()
+	: m_EventCount(0)
+	, m_TypeCounts{}
+{
+}
+
+void GameEventQueue::Push(GameEventType type, const Vector2f& position /*= Vector2f()*/)
+{
+	++m_TypeCounts[static_cast<std::size_t>(type)];
+
+	// Full: the event still counts, only its details are lost
+	if (m_EventCount < CAPACITY)
+	{
+		m_Events[m_EventCount++] = { type, position };
+	}
+}
+
+void GameEventQueue::Clear()
+{
+	m_EventCount = 0;
+	m_TypeCounts.fill(0);
+}
@@ -0,0 +1,118 @@
+/*!
+ * \file GameEventQueue.h
+ *
+ * \brief Contains the GameEventType enum, the GameEvent struct and the GameEventQueue singleton, which collects what
+ * happened during the simulation so that side effects (sounds, effects) run once per frame instead of inline.
+ *
+ * Gameplay code only records facts ("an enemy died here") while it simulates; systems such as the SoundEventPlayer
+ * read the whole frame's events afterwards and decide what to do with them. This keeps audio out of the collision
+ * loop and lets a burst of identical events be merged into one reaction.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @enum GameEventType
+ * @brief The kinds of gameplay events.
+ */
+enum class GameEventType
+{
+	ENEMY_KILLED = 0, ///< An enemy was removed after being hit
+	PLAYER_HIT,       ///< An enemy projectile hit the spaceship
+	SHOT_FIRED,       ///< The spaceship fired a projectile
+	COUNT             ///< Number of event types, not an event
+};
+
+/**
+ * @struct GameEvent
+ * @brief One thing that happened during a simulation tick.
+ */
+struct GameEvent
+{
+	GameEventType type = GameEventType::ENEMY_KILLED; ///< What happened
+	Vector2f position;                                ///< Where it happened, in window coordinates
+};
+
+/**
+ * @class GameEventQueue
+ * @brief Singleton holding the events pushed since the last Clear(), in a fixed-size array.
+ *
+ * Pushing never allocates. When the array is full further events are not stored, but they are still counted per
+ * type, so consumers that only need "did it happen and how often" stay correct.
+ *
+ * Typical usage, once per frame:
+ * - gameplay code Push()es during every simulation tick
+ * - consumers read GetEvents() / GetCount()
+ * - the game loop calls Clear()
+ */
+class GameEventQueue
+{
+public:
+	static constexpr std::size_t CAPACITY = 1024; ///< Events stored per frame
+
+	/**
+	 * @brief Retrieves the singleton instance of the GameEventQueue.
+	 *
+	 * @return Reference to the global GameEventQueue instance.
+	 */
+	static GameEventQueue& Get()
+	{
+		static GameEventQueue instance;
+		return instance;
+	}
+
+	/**
+	 * @brief Records an event.
+	 *
+	 * @param type What happened.
+	 * @param position Where it happened.
+	 */
+	void Push(GameEventType type, const Vector2f& position = Vector2f());
+
+	/**
+	 * @brief Forgets every event, ready for the next frame.
+	 */
+	void Clear();
+
+	// Getters
+
+	/**
+	 * @brief Gets the stored events, in the order they were pushed.
+	 *
+	 * @return A pointer to the first event; GetEventCount() events follow it.
+	 */
+	inline const GameEvent* GetEvents() const { return m_Events.data(); }
+
+	/**
+	 * @brief Gets the number of stored events.
+	 *
+	 * @return The stored event count, at most CAPACITY.
+	 */
+	inline std::size_t GetEventCount() const { return m_EventCount; }
+
+	/**
+	 * @brief Gets how many events of a type were pushed since the last Clear(), stored or not.
+	 *
+	 * @param type The event type.
+	 * @return The number of events of that type.
+	 */
+	inline std::size_t GetCount(GameEventType type) const { return m_TypeCounts[static_cast<std::size_t>(type)]; }
+
+private:
+	/**
+	 * @brief Private constructor to enforce singleton pattern.
+	 */
+	GameEventQueue();
+
+	// Deleted copy constructor and assignment operator
+	GameEventQueue(const GameEventQueue&) = delete;
+	GameEventQueue& operator=(const GameEventQueue&) = delete;
+
+private:
+	std::array<GameEvent, CAPACITY> m_Events;                                      ///< Stored events
+	std::size_t m_EventCount;                                                      ///< Number of stored events
+	std::array<std::size_t, static_cast<std::size_t>(GameEventType::COUNT)> m_TypeCounts; ///< Events pushed per type
+};
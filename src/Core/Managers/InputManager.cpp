@@ -1,13 +1,48 @@
 #include "stdafx.h"
 #include "InputManager.h"
 
+static_assert(static_cast<std::size_t>(KeyBind::Right_click) < RECORDED_KEY_COUNT, "Every KeyBind must fit in a recorded frame");
+
+InputManager::InputManager()
+	: m_SessionSeed(static_cast<std::uint64_t>(std::time(0)))
+{
+}
 
 void InputManager::Update(float deltaTime)
 {
 	m_PreviousKey = m_CurrentKey;
-	m_CurrentKey.reset(); // Clear the current key states before polling
-	UpdateKeyboard();
-	UpdateMouse();
+
+	InputFrame frame;
+	if (m_IsPlayingBack && m_Playback.Next(frame))
+	{
+		ApplyFrame(frame);
+	}
+	else
+	{
+		if (m_IsPlayingBack)
+		{
+			Log::Print("Input playback finished, ticks", m_Playback.GetTickCount());
+			m_IsPlayingBack = false;
+		}
+
+		// Scripted input replaces polling entirely, there may not even be a window to poll
+		if (m_IsScripted)
+		{
+			m_CurrentKey = m_ScriptedKey;
+			m_CursorPosition = m_ScriptedCursor;
+		}
+		else
+		{
+			m_CurrentKey.reset(); // Clear the current key states before polling
+			UpdateKeyboard();
+			UpdateMouse();
+		}
+	}
+
+	if (m_IsRecording)
+	{
+		m_Recorder.Record(MakeFrame());
+	}
 }
 
 
@@ -30,6 +65,11 @@ void InputManager::UpdateMouse()
 	{
 		m_CurrentKey.set(static_cast<int>(KeyBind::Right_click));
 	}
+
+	if (m_Window != nullptr)
+	{
+		m_CursorPosition = Vector2i(sf::Mouse::getPosition(*m_Window));
+	}
 }
 
 bool InputManager::IsKeyPress(KeyBind key)
@@ -42,3 +82,79 @@ bool InputManager::IsKeyDown(KeyBind key)
 {
 	return m_CurrentKey.test(static_cast<int>(key));
 }
+
+void InputManager::SetScripted(bool isScripted)
+{
+	m_IsScripted = isScripted;
+	m_ScriptedKey.reset();
+}
+
+void InputManager::SetScriptedKey(KeyBind key, bool isDown)
+{
+	m_ScriptedKey.set(static_cast<int>(key), isDown);
+}
+
+void InputManager::SetScriptedCursor(const Vector2i& position)
+{
+	m_ScriptedCursor = position;
+}
+
+void InputManager::SetWindow(const sf::Window* window)
+{
+	m_Window = window;
+}
+
+void InputManager::StartRecording(float tickRate)
+{
+	m_Recorder.Begin(m_SessionSeed, tickRate);
+	m_IsRecording = true;
+}
+
+bool InputManager::StopRecording(const std::string& path)
+{
+	if (!m_IsRecording)
+	{
+		return false;
+	}
+
+	m_IsRecording = false;
+	return m_Recorder.Save(path);
+}
+
+bool InputManager::StartPlayback(const std::string& path)
+{
+	if (!m_Playback.Load(path))
+	{
+		m_IsPlayingBack = false;
+		return false;
+	}
+
+	m_SessionSeed = m_Playback.GetSeed();
+	m_IsPlayingBack = true;
+	Log::Print("Replaying input recording " + path + ", ticks", m_Playback.GetTickCount());
+	return true;
+}
+
+InputFrame InputManager::MakeFrame() const
+{
+	InputFrame frame;
+	frame.cursorPosition = m_CursorPosition;
+	for (std::size_t key = 0; key < RECORDED_KEY_COUNT; ++key)
+	{
+		if (m_CurrentKey.test(key))
+		{
+			frame.keys |= static_cast<std::uint16_t>(1u << key);
+		}
+	}
+	return frame;
+}
+
+void InputManager::ApplyFrame(const InputFrame& frame)
+{
+	m_CurrentKey.reset();
+	for (std::size_t key = 0; key < RECORDED_KEY_COUNT; ++key)
+	{
+		m_CurrentKey.set(key, (frame.keys >> key) & 1u);
+	}
+	m_CursorPosition = frame.cursorPosition;
+}
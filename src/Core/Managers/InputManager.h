@@ -7,12 +7,14 @@
  * The InputManager class handles input detection for both keyboard and mouse.
  * It uses a bitset to track the current and previous state of keys/buttons.
  * This system allows the game to check for key presses and key holds efficiently.
+ * It also owns the cursor position of the tick, and can record or replay both to make a session reproducible.
  *
  * \author Felix Atanasescu - HE20830
  * \date April 2025
  */
 
 #pragma once
+#include "InputRecording.h"
 
 constexpr uint32_t MAX_KEYS = 650; ///< Maximum number of keys supported
 
@@ -43,6 +45,9 @@ enum class KeyBind
  * - Detecting key presses (single-frame)
  * - Detecting key holds (multi-frame)
  * - Abstracting low-level SFML input to game-level actions
+ * - Recording the input of every Update() to a file, and replaying such a file instead of the devices
+ *
+ * Update() runs once per tick, so a replayed file feeds the scenes exactly the input they saw when it was recorded.
  */
 class InputManager
 {
@@ -88,11 +93,122 @@ public:
 	 */
 	bool IsKeyDown(KeyBind key);
 
+	/**
+	 * @brief Switches between polling the real devices and replaying scripted key states.
+	 *
+	 * While scripted, Update() takes the key states set with SetScriptedKey() instead of polling SFML, so
+	 * IsKeyPress()/IsKeyDown() behave exactly as with a real player. Used by the headless simulation.
+	 *
+	 * @param isScripted True to use scripted key states, false to poll keyboard and mouse.
+	 */
+	void SetScripted(bool isScripted);
+
+	/**
+	 * @brief Sets the state a key will have after the next Update() while scripted.
+	 *
+	 * @param key The logical game key to set.
+	 * @param isDown True if the key is held down.
+	 */
+	void SetScriptedKey(KeyBind key, bool isDown);
+
+	/**
+	 * @brief Sets the cursor position GetCursorPosition() will return after the next Update() while scripted.
+	 *
+	 * @param position The cursor position, in window coordinates.
+	 */
+	void SetScriptedCursor(const Vector2i& position);
+
+	/**
+	 * @brief Sets the window the mouse position is read relative to.
+	 *
+	 * @param window The game window, or nullptr to stop reading the mouse position.
+	 */
+	void SetWindow(const sf::Window* window);
+
+	/**
+	 * @brief Starts capturing the input of every Update() in memory.
+	 *
+	 * @param tickRate The simulation rate the session runs at, in ticks per second, stored for reference.
+	 */
+	void StartRecording(float tickRate);
+
+	/**
+	 * @brief Stops capturing and writes the captured input and the session seed to a file.
+	 *
+	 * @param path The file to create or overwrite.
+	 * @return True on success, false if nothing was recorded or the file could not be written.
+	 */
+	bool StopRecording(const std::string& path);
+
+	/**
+	 * @brief Replays a recorded session: Update() takes its input from the file instead of the devices.
+	 *
+	 * The session seed becomes the one the file was recorded with. Once every tick of the file was played, Update()
+	 * goes back to the devices (or the scripted states).
+	 *
+	 * @param path The file written by StopRecording().
+	 * @return True on success, false if the file could not be loaded.
+	 */
+	bool StartPlayback(const std::string& path);
+
+	/**
+	 * @brief Sets the seed the session's random streams derive from.
+	 *
+	 * @param seed The seed, written to recordings and replaced by StartPlayback().
+	 */
+	inline void SetSessionSeed(std::uint64_t seed) { m_SessionSeed = seed; }
+
+	// Getters
+
+	/**
+	 * @brief Gets the cursor position read by the last Update().
+	 *
+	 * @return The cursor position, in window coordinates.
+	 */
+	inline const Vector2i& GetCursorPosition() const { return m_CursorPosition; }
+
+	/**
+	 * @brief Gets the seed the session's random streams derive from.
+	 *
+	 * Anything random in the simulation must be seeded from it, or replays would diverge.
+	 *
+	 * @return The seed, time-based unless set or loaded from a recording.
+	 */
+	inline std::uint64_t GetSessionSeed() const { return m_SessionSeed; }
+
+	/**
+	 * @brief Checks whether Update() is capturing input.
+	 *
+	 * @return True between StartRecording() and StopRecording().
+	 */
+	inline bool IsRecording() const { return m_IsRecording; }
+
+	/**
+	 * @brief Checks whether Update() takes its input from a recording.
+	 *
+	 * @return True from StartPlayback() until the last recorded tick was played.
+	 */
+	inline bool IsPlayingBack() const { return m_IsPlayingBack; }
+
+	/**
+	 * @brief Gets the simulation rate of the recording being played.
+	 *
+	 * @return The recorded tick rate, in ticks per second.
+	 */
+	inline float GetPlaybackTickRate() const { return m_Playback.GetTickRate(); }
+
+	/**
+	 * @brief Gets the number of ticks of the recording being played.
+	 *
+	 * @return The recorded tick count.
+	 */
+	inline std::uint32_t GetPlaybackTickCount() const { return m_Playback.GetTickCount(); }
+
 private:
 	/**
 	* @brief Private constructor to enforce singleton pattern.
 	*/
-	InputManager() = default;
+	InputManager();
 
 	// Deleted copy constructor and assignment operator
 	InputManager(const InputManager&) = delete;
@@ -108,12 +224,38 @@ private:
 	/**
 	 * @brief Polls SFML mouse button state and sets flags accordingly.
 	 *
-	 * Maps mouse buttons to KeyBind enums.
+	 * Maps mouse buttons to KeyBind enums, and reads the cursor position.
 	 */
 	void UpdateMouse();
 
+	/**
+	 * @brief Packs the current key states and cursor position into a recorded frame.
+	 *
+	 * @return The input of the tick.
+	 */
+	InputFrame MakeFrame() const;
+
+	/**
+	 * @brief Applies a recorded frame as the current key states and cursor position.
+	 *
+	 * @param frame The input of the tick.
+	 */
+	void ApplyFrame(const InputFrame& frame);
+
 private:
 	std::bitset<MAX_KEYS> m_CurrentKey;   ///< Bitset for current frame key states
 	std::bitset<MAX_KEYS> m_PreviousKey = 0; ///< Bitset for previous frame key states
+	std::bitset<MAX_KEYS> m_ScriptedKey;  ///< Key states used by Update() while scripted
+	bool m_IsScripted = false;            ///< Whether Update() reads m_ScriptedKey instead of polling SFML
+
+	Vector2i m_CursorPosition;            ///< Cursor position of the current frame
+	Vector2i m_ScriptedCursor;            ///< Cursor position used by Update() while scripted
+	const sf::Window* m_Window = nullptr; ///< Window the mouse position is read relative to
+
+	InputRecorder m_Recorder;             ///< Captures the input of every Update() while recording
+	InputPlayback m_Playback;             ///< Feeds Update() while playing back
+	std::uint64_t m_SessionSeed;          ///< Seed of the session's random streams
+	bool m_IsRecording = false;           ///< Whether Update() captures its input
+	bool m_IsPlayingBack = false;         ///< Whether Update() reads m_Playback instead of the devices
 };
 
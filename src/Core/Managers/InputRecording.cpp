@@ -0,0 +1,185 @@
+#include "stdafx.h"
+#include "InputRecording.h"
+#include <fstream>
+
+// ********************* INPUT RECORDING CONSTANTS ********************
+constexpr char RECORDING_MAGIC[4] = { 'M', 'O', 'O', 'I' };
+constexpr std::uint16_t RECORDING_VERSION = 1;
+constexpr std::size_t HEADER_SIZE = 4 + 2 + 2 + 8 + 4 + 4;  // Bytes before the first run
+constexpr std::size_t RUN_SIZE = 2 + 2 + 2 + 2;             // Bytes of one run
+// ****************************************************
+
+namespace
+{
+	/**
+	 * @brief Appends an unsigned integer to a buffer, least significant byte first.
+	 */
+	template <typename T>
+	void WriteValue(std::vector<char>& buffer, T value)
+	{
+		for (std::size_t i = 0; i < sizeof(T); ++i)
+		{
+			buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+		}
+	}
+
+	/**
+	 * @brief Reads an unsigned integer stored least significant byte first, and moves past it.
+	 */
+	template <typename T>
+	T ReadValue(const char*& data)
+	{
+		T value = 0;
+		for (std::size_t i = 0; i < sizeof(T); ++i)
+		{
+			value |= static_cast<T>(static_cast<unsigned char>(data[i])) << (8 * i);
+		}
+		data += sizeof(T);
+		return value;
+	}
+
+	/**
+	 * @brief Narrows a cursor coordinate to the 16 bits stored per run.
+	 */
+	std::uint16_t PackCoordinate(int coordinate)
+	{
+		const int clamped = std::clamp(coordinate, static_cast<int>(INT16_MIN), static_cast<int>(INT16_MAX));
+		return static_cast<std::uint16_t>(static_cast<std::int16_t>(clamped));
+	}
+}
+
+void InputRecorder::Begin(std::uint64_t seed, float tickRate)
+{
+	m_Runs.clear();
+	m_Seed = seed;
+	m_TickRate = static_cast<std::uint16_t>(std::lround(tickRate));
+	m_TickCount = 0;
+}
+
+void InputRecorder::Record(const InputFrame& frame)
+{
+	// Extend the current run while the input does not change
+	if (!m_Runs.empty() && m_Runs.back().frame == frame && m_Runs.back().length < UINT16_MAX)
+	{
+		++m_Runs.back().length;
+	}
+	else
+	{
+		Run run;
+		run.frame = frame;
+		run.length = 1;
+		m_Runs.push_back(run);
+	}
+
+	++m_TickCount;
+}
+
+bool InputRecorder::Save(const std::string& path) const
+{
+	std::vector<char> buffer;
+	buffer.reserve(HEADER_SIZE + m_Runs.size() * RUN_SIZE);
+
+	buffer.insert(buffer.end(), std::begin(RECORDING_MAGIC), std::end(RECORDING_MAGIC));
+	WriteValue(buffer, RECORDING_VERSION);
+	WriteValue(buffer, m_TickRate);
+	WriteValue(buffer, m_Seed);
+	WriteValue(buffer, m_TickCount);
+	WriteValue(buffer, static_cast<std::uint32_t>(m_Runs.size()));
+
+	for (const Run& run : m_Runs)
+	{
+		WriteValue(buffer, PackCoordinate(run.frame.cursorPosition.x));
+		WriteValue(buffer, PackCoordinate(run.frame.cursorPosition.y));
+		WriteValue(buffer, run.frame.keys);
+		WriteValue(buffer, run.length);
+	}
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file)
+	{
+		Log::Print("Failed to create input recording: " + path, LogLevel::ERROR_);
+		return false;
+	}
+
+	file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	if (!file)
+	{
+		Log::Print("Failed to write input recording: " + path, LogLevel::ERROR_);
+		return false;
+	}
+
+	Log::Print("Input recording saved to " + path + ", ticks", m_TickCount);
+	return true;
+}
+
+bool InputPlayback::Load(const std::string& path)
+{
+	m_Frames.clear();
+	m_Lengths.clear();
+	m_RunIndex = 0;
+	m_RunTick = 0;
+
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		Log::Print("Failed to open input recording: " + path, LogLevel::ERROR_);
+		return false;
+	}
+
+	const std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (buffer.size() < HEADER_SIZE || !std::equal(std::begin(RECORDING_MAGIC), std::end(RECORDING_MAGIC), buffer.begin()))
+	{
+		Log::Print("Not an input recording: " + path, LogLevel::ERROR_);
+		return false;
+	}
+
+	const char* data = buffer.data() + sizeof(RECORDING_MAGIC);
+	const std::uint16_t version = ReadValue<std::uint16_t>(data);
+	if (version != RECORDING_VERSION)
+	{
+		Log::Print("Unsupported input recording version: " + path, LogLevel::ERROR_);
+		return false;
+	}
+
+	m_TickRate = ReadValue<std::uint16_t>(data);
+	m_Seed = ReadValue<std::uint64_t>(data);
+	m_TickCount = ReadValue<std::uint32_t>(data);
+	const std::uint32_t runCount = ReadValue<std::uint32_t>(data);
+
+	if (buffer.size() < HEADER_SIZE + static_cast<std::size_t>(runCount) * RUN_SIZE)
+	{
+		Log::Print("Truncated input recording: " + path, LogLevel::ERROR_);
+		return false;
+	}
+
+	m_Frames.resize(runCount);
+	m_Lengths.resize(runCount);
+	for (std::uint32_t i = 0; i < runCount; ++i)
+	{
+		m_Frames[i].cursorPosition.x = static_cast<std::int16_t>(ReadValue<std::uint16_t>(data));
+		m_Frames[i].cursorPosition.y = static_cast<std::int16_t>(ReadValue<std::uint16_t>(data));
+		m_Frames[i].keys = ReadValue<std::uint16_t>(data);
+		m_Lengths[i] = ReadValue<std::uint16_t>(data);
+	}
+
+	return true;
+}
+
+bool InputPlayback::Next(InputFrame& outFrame)
+{
+	// Skip empty runs, a valid file has none but a hand-edited one might
+	while (!IsFinished() && m_RunTick >= m_Lengths[m_RunIndex])
+	{
+		++m_RunIndex;
+		m_RunTick = 0;
+	}
+
+	if (IsFinished())
+	{
+		return false;
+	}
+
+	outFrame = m_Frames[m_RunIndex];
+	++m_RunTick;
+	return true;
+}
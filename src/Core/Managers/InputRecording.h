@@ -0,0 +1,161 @@
+/*!
+ * \file InputRecording.h
+ *
+ * \brief Contains the InputFrame struct and the InputRecorder and InputPlayback classes, which save the input of a
+ * session to a binary file and read it back tick by tick.
+ *
+ * The simulation only depends on its seed and on what the InputManager hands out each tick, so a file holding both
+ * reproduces a whole session: the same clicks, the same cursor path and the same enemy decisions, on any machine.
+ * That turns a slow session seen once into a run that can be replayed before and after a change.
+ *
+ * File layout (little-endian):
+ * - Header: magic "MOOI", format version (uint16), tick rate in Hz (uint16), seed (uint64), tick count (uint32),
+ *   run count (uint32).
+ * - Runs: cursor x and y (int16 each), KeyBind bits (uint16), number of consecutive ticks with that input (uint16).
+ *
+ * Consecutive identical ticks are stored as one run, so idle stretches cost nothing and a moving mouse costs 8 bytes
+ * per tick.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+constexpr std::size_t RECORDED_KEY_COUNT = 16; ///< KeyBinds stored per tick, the bits of InputFrame::keys
+
+/**
+ * @struct InputFrame
+ * @brief The input of one tick, as seen by the game.
+ */
+struct InputFrame
+{
+	Vector2i cursorPosition;  ///< Cursor position in window coordinates
+	std::uint16_t keys = 0;   ///< Bit i is set while KeyBind i is held down
+
+	bool operator==(const InputFrame& other) const
+	{
+		return cursorPosition == other.cursorPosition && keys == other.keys;
+	}
+};
+
+/**
+ * @class InputRecorder
+ * @brief Collects one InputFrame per tick in memory and writes them to a file at the end.
+ *
+ * Nothing touches the disk while recording, so recording does not disturb the frame times it is meant to reproduce.
+ */
+class InputRecorder
+{
+public:
+	/**
+	 * @brief Drops any recorded ticks and starts a new recording.
+	 *
+	 * @param seed The seed the session was started with.
+	 * @param tickRate The simulation rate, in ticks per second.
+	 */
+	void Begin(std::uint64_t seed, float tickRate);
+
+	/**
+	 * @brief Appends the input of one tick.
+	 *
+	 * @param frame The input the game used this tick.
+	 */
+	void Record(const InputFrame& frame);
+
+	/**
+	 * @brief Writes the recording to a file.
+	 *
+	 * @param path The file to create or overwrite.
+	 * @return True on success, false if the file could not be written.
+	 */
+	bool Save(const std::string& path) const;
+
+	// Getters
+
+	/**
+	 * @brief Gets the number of ticks recorded since Begin().
+	 *
+	 * @return The tick count.
+	 */
+	inline std::uint32_t GetTickCount() const { return m_TickCount; }
+
+private:
+	/**
+	 * @struct Run
+	 * @brief Consecutive ticks sharing the same input.
+	 */
+	struct Run
+	{
+		InputFrame frame;          ///< The input of every tick of the run
+		std::uint16_t length = 0;  ///< The number of ticks
+	};
+
+	std::vector<Run> m_Runs;       ///< The recorded ticks, run-length encoded
+	std::uint64_t m_Seed = 0;      ///< The seed written to the header
+	std::uint16_t m_TickRate = 0;  ///< The tick rate written to the header, in Hz
+	std::uint32_t m_TickCount = 0; ///< The number of ticks in m_Runs
+};
+
+/**
+ * @class InputPlayback
+ * @brief Loads a recording and hands its InputFrames out again, one per tick.
+ */
+class InputPlayback
+{
+public:
+	/**
+	 * @brief Loads a recording and rewinds to its first tick.
+	 *
+	 * @param path The file written by InputRecorder::Save().
+	 * @return True on success, false if the file is missing, truncated or not a recording.
+	 */
+	bool Load(const std::string& path);
+
+	/**
+	 * @brief Gets the input of the next tick.
+	 *
+	 * @param outFrame Receives the input of the tick.
+	 * @return True if a tick was read, false once every tick was played.
+	 */
+	bool Next(InputFrame& outFrame);
+
+	// Getters
+
+	/**
+	 * @brief Gets the seed the recorded session was started with.
+	 *
+	 * @return The seed.
+	 */
+	inline std::uint64_t GetSeed() const { return m_Seed; }
+
+	/**
+	 * @brief Gets the simulation rate the session was recorded at.
+	 *
+	 * @return The tick rate, in ticks per second.
+	 */
+	inline float GetTickRate() const { return static_cast<float>(m_TickRate); }
+
+	/**
+	 * @brief Gets the number of ticks in the recording.
+	 *
+	 * @return The tick count.
+	 */
+	inline std::uint32_t GetTickCount() const { return m_TickCount; }
+
+	/**
+	 * @brief Checks whether every tick was played.
+	 *
+	 * @return True once Next() has nothing left to return.
+	 */
+	inline bool IsFinished() const { return m_RunIndex >= m_Frames.size(); }
+
+private:
+	std::vector<InputFrame> m_Frames;     ///< The input of each run
+	std::vector<std::uint16_t> m_Lengths; ///< The number of ticks of each run
+	std::size_t m_RunIndex = 0;           ///< The run the next tick is taken from
+	std::uint16_t m_RunTick = 0;          ///< Ticks of the current run already played
+	std::uint64_t m_Seed = 0;             ///< The seed read from the header
+	std::uint16_t m_TickRate = 0;         ///< The tick rate read from the header, in Hz
+	std::uint32_t m_TickCount = 0;        ///< The tick count read from the header
+};
@@ -0,0 +1,311 @@
+#include "stdafx.h"
+#include "ResourceCache.h"
+#include "AssetPack.h"
+#include <filesystem>
+
+namespace
+{
+	/**
+	 * @brief Gets the video memory of a texture, 4 bytes per pixel.
+	 */
+	std::size_t GetMemorySize(const sf::Texture& texture, const std::string&)
+	{
+		return static_cast<std::size_t>(texture.getSize().x) * texture.getSize().y * 4;
+	}
+
+	/**
+	 * @brief Gets the memory of a font; FreeType reads the face from its file on demand, the file size is the closest measure.
+	 */
+	std::size_t GetMemorySize(const sf::Font&, const std::string& fileName)
+	{
+		const AssetView view = AssetPack::Get().Find(fileName);
+		if (view.IsValid())
+		{
+			return view.size;
+		}
+
+		std::error_code error;
+		const std::uintmax_t size = std::filesystem::file_size(fileName, error);
+		return error ? 0 : static_cast<std::size_t>(size);
+	}
+
+	/**
+	 * @brief Gets the memory of the decoded samples of a sound buffer.
+	 */
+	std::size_t GetMemorySize(const sf::SoundBuffer& soundBuffer, const std::string&)
+	{
+		return static_cast<std::size_t>(soundBuffer.getSampleCount()) * sizeof(sf::Int16);
+	}
+}
+
+template <typename T>
+std::shared_ptr<T> ResourceCache::Acquire(std::unordered_map<std::string, std::shared_ptr<T>>& cache, TrackedMemory& memory, const std::string& fileName)
+{
+	// Hand out the already loaded instance if we have one
+	auto it = cache.find(fileName);
+	if (it != cache.end())
+	{
+		return it->second;
+	}
+
+	// First request for this path, decode it from the asset pack or from disk
+	std::shared_ptr<T> resource = std::make_shared<T>();
+	if (!AssetPack::Get().Load(*resource, fileName))
+	{
+		Log::Print("Failed to load resource", fileName, LogLevel::ERROR_);
+		return nullptr;
+	}
+
+	Store(cache, memory, fileName, resource);
+	return resource;
+}
+
+template <typename T>
+void ResourceCache::Store(std::unordered_map<std::string, std::shared_ptr<T>>& cache, TrackedMemory& memory, const std::string& fileName, const std::shared_ptr<T>& resource)
+{
+	if (cache.emplace(fileName, resource).second)
+	{
+		memory.Resize(memory.GetBytes() + GetMemorySize(*resource, fileName));
+	}
+}
+
+std::shared_ptr<sf::Texture> ResourceCache::GetTexture(const std::string& fileName)
+{
+	return Acquire(m_Textures, m_TextureMemory, fileName);
+}
+
+std::shared_ptr<sf::Font> ResourceCache::GetFont(const std::string& fileName)
+{
+	return Acquire(m_Fonts, m_FontMemory, fileName);
+}
+
+std::shared_ptr<sf::SoundBuffer> ResourceCache::GetSoundBuffer(const std::string& fileName)
+{
+	return Acquire(m_SoundBuffers, m_SoundMemory, fileName);
+}
+
+sf::Vector2u ResourceCache::GetTextureSize(const std::string& fileName)
+{
+#ifdef MOO_HEADLESS
+	auto it = m_TextureSizes.find(fileName);
+	if (it != m_TextureSizes.end())
+	{
+		return it->second;
+	}
+
+	// Decoding the image does not need a GPU context, unlike creating an sf::Texture
+	sf::Image image;
+	if (!AssetPack::Get().Load(image, fileName))
+	{
+		Log::Print("Failed to load resource", fileName, LogLevel::ERROR_);
+		return sf::Vector2u(0, 0);
+	}
+
+	m_TextureSizes.emplace(fileName, image.getSize());
+	return image.getSize();
+#else
+	const SpriteRegion region = GetSpriteRegion(fileName);
+	return sf::Vector2u(static_cast<unsigned int>(region.rect.width), static_cast<unsigned int>(region.rect.height));
+#endif
+}
+
+bool ResourceCache::BuildAtlas(const std::vector<std::string>& fileNames)
+{
+	for (const std::string& fileName : fileNames)
+	{
+		m_Atlas.Add(fileName, fileName);
+	}
+
+	return m_Atlas.Build();
+}
+
+SpriteRegion ResourceCache::GetSpriteRegion(const std::string& fileName)
+{
+	SpriteRegion region;
+
+	// Packed images share a page with the rest of the atlas
+	const AtlasRegion* atlasRegion = m_Atlas.FindRegion(fileName);
+	if (atlasRegion != nullptr)
+	{
+		region.texture = m_Atlas.GetPage(atlasRegion->page);
+		region.rect = atlasRegion->rect;
+		return region;
+	}
+
+	// Anything else is a standalone texture
+	region.texture = GetTexture(fileName);
+	if (region.texture != nullptr)
+	{
+		const sf::Vector2u size = region.texture->getSize();
+		region.rect = sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y));
+	}
+
+	return region;
+}
+
+void ResourceCache::PreloadTexture(const std::string& fileName)
+{
+	if (m_Textures.find(fileName) != m_Textures.end())
+	{
+		return;
+	}
+
+	m_Loader.Request(AssetType::IMAGE, fileName);
+	++m_PreloadCount;
+}
+
+void ResourceCache::PreloadFont(const std::string& fileName)
+{
+	if (m_Fonts.find(fileName) != m_Fonts.end())
+	{
+		return;
+	}
+
+	m_Loader.Request(AssetType::FONT, fileName);
+	++m_PreloadCount;
+}
+
+void ResourceCache::PreloadSoundBuffer(const std::string& fileName)
+{
+	if (m_SoundBuffers.find(fileName) != m_SoundBuffers.end())
+	{
+		return;
+	}
+
+	m_Loader.Request(AssetType::SOUND_BUFFER, fileName);
+	++m_PreloadCount;
+}
+
+void ResourceCache::PreloadAtlas(const std::vector<std::string>& fileNames)
+{
+#ifdef MOO_HEADLESS
+	// No pages without a GPU context, the images only provide their sizes
+	for (const std::string& fileName : fileNames)
+	{
+		PreloadTexture(fileName);
+	}
+#else
+	for (const std::string& fileName : fileNames)
+	{
+		if (m_PendingAtlasImages.insert(fileName).second)
+		{
+			m_Loader.Request(AssetType::IMAGE, fileName);
+			++m_PreloadCount;
+		}
+	}
+
+	m_IsAtlasQueued = !m_PendingAtlasImages.empty();
+#endif
+}
+
+bool ResourceCache::FinishPendingLoads(float timeBudget)
+{
+	MOO_PROFILE_FUNCTION();
+	sf::Clock clock;
+	do
+	{
+		m_FinishedAssets.clear();
+		if (m_Loader.PopLoaded(m_FinishedAssets, 1) == 0)
+		{
+			break;
+		}
+
+		FinishLoad(m_FinishedAssets.back());
+	} while (clock.getElapsedTime().asSeconds() < timeBudget);
+
+	// The atlas is packed in one go once its last image has arrived; its pages are new textures, which the frame in
+	// flight cannot sample yet, uploaded through the shared context
+	if (m_IsAtlasQueued && m_PendingAtlasImages.empty())
+	{
+		m_Atlas.Build();
+		m_IsAtlasQueued = false;
+	}
+
+	return !IsLoading();
+}
+
+float ResourceCache::GetLoadProgress() const
+{
+	if (m_PreloadCount == 0)
+	{
+		return 1.0f;
+	}
+
+	return static_cast<float>(m_FinishedCount) / static_cast<float>(m_PreloadCount);
+}
+
+bool ResourceCache::IsLoading() const
+{
+	return m_IsAtlasQueued || m_Loader.GetPendingCount() > 0;
+}
+
+void ResourceCache::FinishLoad(LoadedAsset& asset)
+{
+	++m_FinishedCount;
+	if (!asset.succeeded)
+	{
+		Log::Print("Failed to load resource", asset.fileName, LogLevel::ERROR_);
+		m_PendingAtlasImages.erase(asset.fileName);
+		return;
+	}
+
+	switch (asset.type)
+	{
+	case AssetType::IMAGE:
+	{
+		// Atlas images wait for the rest of the atlas
+		if (m_PendingAtlasImages.erase(asset.fileName) > 0)
+		{
+			m_Atlas.Add(asset.fileName, asset.image);
+			break;
+		}
+
+#ifdef MOO_HEADLESS
+		m_TextureSizes.emplace(asset.fileName, asset.image.getSize());
+#else
+		// Uploaded here, on the main thread, through SFML's hidden context shared with the window's, not on the worker
+		MOO_PROFILE_SCOPE("UploadTexture");
+		std::shared_ptr<sf::Texture> texture = std::make_shared<sf::Texture>();
+		if (!texture->loadFromImage(asset.image))
+		{
+			Log::Print("Failed to upload texture", asset.fileName, LogLevel::ERROR_);
+			break;
+		}
+
+		Store(m_Textures, m_TextureMemory, asset.fileName, texture);
+#endif
+		break;
+	}
+
+	case AssetType::FONT:
+		Store(m_Fonts, m_FontMemory, asset.fileName, asset.font);
+		break;
+
+	case AssetType::SOUND_BUFFER:
+		Store(m_SoundBuffers, m_SoundMemory, asset.fileName, asset.soundBuffer);
+		break;
+	}
+}
+
+void ResourceCache::ReleaseUnused()
+{
+	// A use count of one means the cache holds the only reference left
+	auto releaseFrom = [](auto& cache, TrackedMemory& memory)
+		{
+			for (auto it = cache.begin(); it != cache.end(); )
+			{
+				if (it->second.use_count() != 1)
+				{
+					++it;
+					continue;
+				}
+
+				memory.Resize(memory.GetBytes() - GetMemorySize(*it->second, it->first));
+				it = cache.erase(it);
+			}
+		};
+
+	releaseFrom(m_Textures, m_TextureMemory);
+	releaseFrom(m_Fonts, m_FontMemory);
+	releaseFrom(m_SoundBuffers, m_SoundMemory);
+}
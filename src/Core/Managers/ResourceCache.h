@@ -0,0 +1,243 @@
+/*!
+ * \file ResourceCache.h
+ *
+ * \brief Declares the ResourceCache singleton that shares textures, fonts and sound buffers.
+ *
+ * Every asset is loaded from disk the first time it is requested and then handed out as a
+ * reference-counted handle. Later requests for the same path return the same instance, so each
+ * file is decoded (and, for textures, uploaded to the GPU) only once per process.
+ *
+ * Assets can also be preloaded: the files are decoded by the AssetLoader's worker threads while the main thread keeps
+ * drawing, and FinishPendingLoads() moves them into the cache (uploading textures) a few at a time.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "Core/Rendering/TextureAtlas.h"
+#include "Core/Managers/AssetLoader.h"
+
+/**
+ * @struct SpriteRegion
+ * @brief A texture plus the rectangle of it a sprite should display.
+ *
+ * For images packed into the atlas the texture is an atlas page shared with many other sprites; for the rest it is
+ * the image's own texture and the rectangle covers all of it.
+ */
+struct SpriteRegion
+{
+	std::shared_ptr<sf::Texture> texture; ///< The texture to sample, nullptr if the image could not be loaded
+	sf::IntRect rect;                     ///< The part of the texture showing the image
+};
+
+ /**
+  * @class ResourceCache
+  * @brief Singleton cache for heavy SFML resources, keyed by the paths in Strings.h.
+  *
+  * The cache keeps a strong reference to every loaded resource, so assets stay resident even
+  * when no entity currently uses them (e.g. projectile textures between shots).
+  * Call ReleaseUnused() to drop resources that nobody else references anymore.
+  *
+  * Small gameplay images can be packed into a texture atlas with BuildAtlas(); GetSpriteRegion() then resolves their
+  * paths to a shared atlas page, so every sprite using them can be drawn with a single texture bind.
+  *
+  * Typical asynchronous usage, all on the main thread:
+  * - Preload*() every asset the game needs (returns immediately)
+  * - FinishPendingLoads() once per frame until it returns true, showing GetLoadProgress()
+  * - Get*() as usual, which now hits the cache
+  *
+  * Get*() on a path that is still loading falls back to a synchronous load, so preloading is an optimisation only.
+  */
+class ResourceCache
+{
+public:
+	/**
+	 * @brief Retrieves the singleton instance of the ResourceCache.
+	 *
+	 * @return Reference to the global ResourceCache instance.
+	 */
+	static ResourceCache& Get()
+	{
+		static ResourceCache instance;
+		return instance;
+	}
+
+	/**
+	 * @brief Returns the texture stored at the given path, loading it on first use.
+	 *
+	 * @param fileName The path of the texture to load.
+	 * @return A shared handle to the texture, or nullptr if the file could not be loaded.
+	 */
+	std::shared_ptr<sf::Texture> GetTexture(const std::string& fileName);
+
+	/**
+	 * @brief Returns the font stored at the given path, loading it on first use.
+	 *
+	 * @param fileName The path of the font to load.
+	 * @return A shared handle to the font, or nullptr if the file could not be loaded.
+	 */
+	std::shared_ptr<sf::Font> GetFont(const std::string& fileName);
+
+	/**
+	 * @brief Returns the sound buffer stored at the given path, loading it on first use.
+	 *
+	 * @param fileName The path of the audio file to load.
+	 * @return A shared handle to the sound buffer, or nullptr if the file could not be loaded.
+	 */
+	std::shared_ptr<sf::SoundBuffer> GetSoundBuffer(const std::string& fileName);
+
+	/**
+	 * @brief Returns the pixel size of the texture stored at the given path.
+	 *
+	 * Headless builds (MOO_HEADLESS) have no GPU context and never create textures, so the size is read from the
+	 * decoded image instead and cached separately.
+	 *
+	 * @param fileName The path of the image file.
+	 * @return The size of the texture, or (0, 0) if the file could not be loaded.
+	 */
+	sf::Vector2u GetTextureSize(const std::string& fileName);
+
+	/**
+	 * @brief Packs images into the texture atlas, replacing any previous atlas.
+	 *
+	 * Each image is registered under its path, so callers keep using the constants from Strings.h.
+	 *
+	 * @param fileNames The paths of the images to pack.
+	 * @return True if the atlas was built.
+	 */
+	bool BuildAtlas(const std::vector<std::string>& fileNames);
+
+	/**
+	 * @brief Returns the texture and rectangle to draw an image with.
+	 *
+	 * Images packed by BuildAtlas() resolve to their atlas region; any other path falls back to GetTexture() with a
+	 * rectangle covering the whole texture.
+	 *
+	 * @param fileName The path of the image.
+	 * @return The region to draw; its texture is nullptr if the image could not be loaded.
+	 */
+	SpriteRegion GetSpriteRegion(const std::string& fileName);
+
+	/**
+	 * @brief Queues a texture to be decoded in the background.
+	 *
+	 * @param fileName The path of the image file.
+	 */
+	void PreloadTexture(const std::string& fileName);
+
+	/**
+	 * @brief Queues a font to be loaded in the background.
+	 *
+	 * @param fileName The path of the font file.
+	 */
+	void PreloadFont(const std::string& fileName);
+
+	/**
+	 * @brief Queues a sound buffer to be decoded in the background.
+	 *
+	 * @param fileName The path of the audio file.
+	 */
+	void PreloadSoundBuffer(const std::string& fileName);
+
+	/**
+	 * @brief Queues images to be decoded in the background and packed into the texture atlas once all have arrived.
+	 *
+	 * The asynchronous counterpart of BuildAtlas().
+	 *
+	 * @param fileNames The paths of the images to pack.
+	 */
+	void PreloadAtlas(const std::vector<std::string>& fileNames);
+
+	/**
+	 * @brief Moves decoded assets into the cache, uploading textures, until the time budget runs out.
+	 *
+	 * Must be called from the main thread. The render thread owns the window's GL context by then; the textures are
+	 * created in SFML's hidden context, shared with the window's, while the render thread may be drawing a frame. At
+	 * least one asset is finished per call.
+	 *
+	 * @param timeBudget The time this call may spend, in seconds.
+	 * @return True once every preloaded asset is in the cache.
+	 */
+	bool FinishPendingLoads(float timeBudget);
+
+	/**
+	 * @brief Gets how much of the preloaded work is finished.
+	 *
+	 * @return The finished fraction, from 0 to 1; 1 when nothing was preloaded.
+	 */
+	float GetLoadProgress() const;
+
+	/**
+	 * @brief Checks whether preloaded assets are still being decoded or finished.
+	 *
+	 * @return True while FinishPendingLoads() has work left.
+	 */
+	bool IsLoading() const;
+
+	/**
+	 * @brief Drops every cached resource that is no longer referenced outside the cache.
+	 */
+	void ReleaseUnused();
+
+private:
+	/**
+	* @brief Private constructor to enforce singleton pattern.
+	*/
+	ResourceCache() = default;
+
+	// Deleted copy constructor and assignment operator
+	ResourceCache(const ResourceCache&) = delete;
+	ResourceCache& operator=(const ResourceCache&) = delete;
+
+	/**
+	 * @brief Looks up a resource in the given map and loads it through the AssetPack on a miss.
+	 *
+	 * @tparam T The SFML resource type (sf::Texture, sf::Font or sf::SoundBuffer).
+	 * @param cache The map holding the already loaded resources of type T.
+	 * @param memory The memory report of the map.
+	 * @param fileName The path of the resource.
+	 * @return A shared handle to the resource, or nullptr if loading failed.
+	 */
+	template <typename T>
+	std::shared_ptr<T> Acquire(std::unordered_map<std::string, std::shared_ptr<T>>& cache, TrackedMemory& memory, const std::string& fileName);
+
+	/**
+	 * @brief Adds a loaded resource to the given map and reports its memory.
+	 *
+	 * @tparam T The SFML resource type (sf::Texture, sf::Font or sf::SoundBuffer).
+	 * @param cache The map holding the already loaded resources of type T.
+	 * @param memory The memory report of the map.
+	 * @param fileName The path of the resource.
+	 * @param resource The loaded resource.
+	 */
+	template <typename T>
+	void Store(std::unordered_map<std::string, std::shared_ptr<T>>& cache, TrackedMemory& memory, const std::string& fileName, const std::shared_ptr<T>& resource);
+
+	/**
+	 * @brief Moves one asset decoded by the AssetLoader into the cache or the pending atlas.
+	 *
+	 * @param asset The decoded asset.
+	 */
+	void FinishLoad(LoadedAsset& asset);
+
+private:
+	std::unordered_map<std::string, std::shared_ptr<sf::Texture>> m_Textures;         ///< Loaded textures by path
+	std::unordered_map<std::string, std::shared_ptr<sf::Font>> m_Fonts;               ///< Loaded fonts by path
+	std::unordered_map<std::string, std::shared_ptr<sf::SoundBuffer>> m_SoundBuffers; ///< Loaded sound buffers by path
+	std::unordered_map<std::string, sf::Vector2u> m_TextureSizes;                      ///< Image sizes by path (headless builds only)
+	TextureAtlas m_Atlas;                                                              ///< Pages holding the packed gameplay images
+
+	// Memory reports
+	TrackedMemory m_TextureMemory{ MemoryTag::TEXTURES };                              ///< Video memory of m_Textures
+	TrackedMemory m_FontMemory{ MemoryTag::UI };                                       ///< Font files behind m_Fonts
+	TrackedMemory m_SoundMemory{ MemoryTag::AUDIO };                                   ///< Samples of m_SoundBuffers
+
+	// Asynchronous loading
+	AssetLoader m_Loader;                                                              ///< Worker threads decoding preloaded files
+	std::unordered_set<std::string> m_PendingAtlasImages;                              ///< Atlas images not decoded yet
+	std::vector<LoadedAsset> m_FinishedAssets;                                         ///< Scratch list reused by FinishPendingLoads()
+	bool m_IsAtlasQueued = false;                                                      ///< True until the preloaded atlas is built
+	std::size_t m_PreloadCount = 0;                                                    ///< Assets requested through Preload*()
+	std::size_t m_FinishedCount = 0;                                                   ///< Preloaded assets already in the cache
+};
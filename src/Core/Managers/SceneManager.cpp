@@ -1,7 +1,32 @@
 #include "stdafx.h" // Precompiled header to improve compilation time
 #include "SceneManager.h"  // Include the header file for the SceneManager class
+#include "Core/Memory/FrameArena.h"
 #include <cassert>    // For runtime assertions (though unused here, potentially useful)
 
+// ********************* SCENE MANAGER CONSTANTS ********************
+constexpr float SLOW_SCENE_START_SECONDS = 1.0f / 60.0f; // Starting a scene should never take longer than a frame
+// ****************************************************
+
+namespace
+{
+	/**
+	 * @brief Gets the name of a scene, for the memory reports.
+	 */
+	const char* GetSceneName(SceneID id)
+	{
+		switch (id)
+		{
+		case MAIN_MENU: return "main menu";
+		case LEVEL_ONE: return "level one";
+		case LEVEL_TWO: return "level two";
+		case GAME_OVER: return "game over";
+		case CREDITS: return "credits";
+		case INTRO: return "intro";
+		default: return "unknown";
+		}
+	}
+}
+
 SceneManager::~SceneManager()
 {
 	// Iterate through all stored states in the manager
@@ -17,6 +42,8 @@ SceneManager::~SceneManager()
 
 void SceneManager::Update(float deltaTime)
 {
+	MOO_PROFILE_FUNCTION();
+
 	// Update the global cursor (if used for input or UI)
 	Cursor::Get().Update();
 
@@ -26,23 +53,35 @@ void SceneManager::Update(float deltaTime)
 		m_Current->Update(deltaTime);
 	}
 }
-void SceneManager::Draw(sf::RenderWindow& window)
+void SceneManager::Draw(RenderSnapshot& snapshot, float alpha)
 {
+	MOO_PROFILE_FUNCTION();
+
 	// Forward the draw call to the current scene
 	if (m_Current != nullptr)
 	{
-		m_Current->Draw();
+		m_Current->Draw(snapshot, alpha);
 	}
 }
 void SceneManager::HandleInput(float deltaTime)
 {
+	MOO_PROFILE_FUNCTION();
+
 	// Let the current scene handle input logic
 	if (m_Current != nullptr)
 	{
 		m_Current->HandleInput(deltaTime);
 	}
 }
-void SceneManager::Add(std::shared_ptr<IGameScene> pushingState, SceneID allocationID)
+void SceneManager::CollectStats(SceneStats& outStats) const
+{
+	if (m_Current != nullptr)
+	{
+		m_Current->CollectStats(outStats);
+	}
+}
+
+void SceneManager::AddScene(std::shared_ptr<IGameScene> pushingState, SceneID allocationID, std::size_t sceneBytes)
 {
 	// Check if the ID already exists to prevent accidental overwrite
 	if (m_States.find(allocationID) != m_States.end()) 
@@ -62,12 +101,15 @@ void SceneManager::Add(std::shared_ptr<IGameScene> pushingState, SceneID allocat
 	auto [it, hadSuccess] = m_States.emplace(allocationID, pushingState);
 	if (hadSuccess)
 	{
+		m_SceneMemory.try_emplace(allocationID, MemoryTag::SCENE).first->second.Resize(sceneBytes);
 		pushingState->OnInit(); // Initialize the state once it's added successfully
 	}
 }
 
 void SceneManager::Switch(SceneID stateID)
 { 
+	MOO_PROFILE_FUNCTION();
+
 	// Look for the scene with the given ID
 	auto it = m_States.find(stateID);
 	auto& [id, state] = *it;
@@ -82,7 +124,22 @@ void SceneManager::Switch(SceneID stateID)
 		}
 
 		m_Current = state; // Set new current state
-		m_Current->OnStart(); // Start the newly switched state
+
+		// Reset the per-run state and start the newly switched state, its assets are already loaded
+		sf::Clock startClock;
+		m_Current->ResetState();
+		m_Current->OnStart();
+
+		const float startSeconds = startClock.getElapsedTime().asSeconds();
+		if (startSeconds > SLOW_SCENE_START_SECONDS)
+		{
+			Log::Print("Starting the scene took longer than a frame, milliseconds", startSeconds * 1000.0f, LogLevel::WARNING);
+		}
+
+		// What the new scene holds once started, and what the previous one left behind
+		FrameString reason("switched to ");
+		reason.append(GetSceneName(stateID));
+		MemoryTracker::Get().Report(reason);
 	}
 }
 
@@ -104,6 +161,7 @@ void SceneManager::Remove(SceneID stateID)
 
 		// Remove the scene from the map
 		m_States.erase(stateID);
+		m_SceneMemory.erase(stateID);
 	}
 }
 
@@ -13,7 +13,8 @@
  */
 
 #pragma once
-
+#include "Core/Memory/MemoryTracker.h"
+class RenderSnapshot;
 
 enum SceneID
 {
@@ -21,7 +22,21 @@ enum SceneID
 	LEVEL_ONE,      ///< First level of the game
 	LEVEL_TWO,      ///< Second level of the game
 	GAME_OVER,      ///< Game over screen
-	CREDITS         ///< Credits screen   
+	CREDITS,        ///< Credits screen   
+	INTRO           ///< Loading screen shown while the assets load
+};
+
+/**
+ * @struct SceneStats
+ * @brief Live entity and batching counts a scene reports to the performance overlay.
+ */
+struct SceneStats
+{
+	std::size_t enemies = 0;            ///< Enemies alive
+	std::size_t enemyProjectiles = 0;   ///< Projectiles fired by enemies still in flight
+	std::size_t playerProjectiles = 0;  ///< Projectiles fired by the player still in flight
+	std::size_t batchedSprites = 0;     ///< Sprites the scene drew through a SpriteBatch this frame
+	std::size_t drawCallsSaved = 0;     ///< Draw calls the SpriteBatch saved compared to one per sprite
 };
 
 /**
@@ -30,7 +45,9 @@ enum SceneID
  *
  * This abstract base class defines the lifecycle of a game scene.
  * Each scene must implement update and draw behavior.
- * Optional lifecycle hooks include initialization, destruction, start, and stop methods.
+ * Optional lifecycle hooks include initialization, destruction, state reset, start, and stop methods.
+ * Assets are acquired once, in the constructor or OnInit(); switching to a scene only resets its state and starts
+ * it, so restarting a level never loads anything.
  */
 class IGameScene
 {
@@ -57,6 +74,13 @@ public:
 	*/
 	virtual void OnDestroy() {};
 
+	/**
+   * @brief Called every time the scene becomes the active one, before OnStart().
+   *
+   * Puts the per-run gameplay data back to its initial values. Must not acquire assets.
+   */
+	virtual void ResetState() {};
+
 	/**
    * @brief Called every time the scene becomes the active one.
    *
@@ -81,11 +105,16 @@ public:
 	virtual void Update(float deltaTime) = 0;
 
 	/**
-  * @brief Draws the scene content to the screen.
+  * @brief Records the scene content into the frame's snapshot.
+  *
+  * Must be implemented by each scene to render its visual content. Rendering runs at the display rate while
+  * Update() runs at a fixed tick rate, so scenes can use the alpha to draw moving objects between their last two
+  * simulated positions. The snapshot is drawn later on the render thread, so scenes never draw to the window.
   *
-  * Must be implemented by each scene to render its visual content.
+  * @param snapshot The frame being recorded.
+  * @param alpha How far the frame is between the previous tick (0) and the current tick (1).
   */
-	virtual void Draw() = 0;
+	virtual void Draw(RenderSnapshot& snapshot, float alpha) = 0;
 
 	/**
 	* @brief Handles input events for the scene.
@@ -95,6 +124,15 @@ public:
 	* @param deltaTime Optional time delta for handling input (default = 0).
 	*/
 	virtual void HandleInput(float deltaTime = 0) {};
+
+	/**
+	* @brief Reports the scene's live entity counts.
+	*
+	* Scenes without entities leave the counts at zero.
+	*
+	* @param outStats Receives the counts.
+	*/
+	virtual void CollectStats(SceneStats& outStats) const {};
 };
 
 /**
@@ -131,9 +169,10 @@ public:
    *
    * Forwards the drawing responsibility to the active scene.
    *
-   * @param window Reference to the SFML window where content will be drawn.
+   * @param snapshot The frame being recorded.
+   * @param alpha The interpolation factor between the previous and the current simulation tick.
    */
-	void Draw(sf::RenderWindow& window);
+	void Draw(RenderSnapshot& snapshot, float alpha);
 
 	/**
 	   * @brief Handles input for the active scene.
@@ -144,20 +183,34 @@ public:
 	   */
 	void HandleInput(float deltaTime);
 
+	/**
+	 * @brief Collects the live entity counts of the active scene.
+	 *
+	 * @param outStats Receives the counts; left at zero when no scene is active.
+	 */
+	void CollectStats(SceneStats& outStats) const;
+
 	/**
 	 * @brief Adds a new scene to the manager.
 	 *
 	 * Associates a scene with a unique SceneID. Throws if the ID already exists.
+	 * The scene object is reported to the MemoryTracker until it is removed.
 	 *
+	 * @tparam T The concrete scene type, which gives the size reported.
 	 * @param pushingState A shared pointer to the scene to be added.
 	 * @param allocationID The ID used to reference this scene.
 	 */
-	void Add(std::shared_ptr<IGameScene> pushingState, SceneID allocationID);
+	template <typename T>
+	void Add(std::shared_ptr<T> pushingState, SceneID allocationID)
+	{
+		static_assert(std::is_base_of_v<IGameScene, T>, "Only scenes can be added");
+		AddScene(pushingState, allocationID, sizeof(T));
+	}
 
 	/**
    * @brief Switches the currently active scene.
    *
-   * Calls OnStop() on the current scene and OnStart() on the new one.
+   * Calls OnStop() on the current scene, ResetState() and OnStart() on the new one, then writes a memory report.
    *
    * @param stateID The ID of the scene to switch to.
    */
@@ -172,6 +225,20 @@ public:
 	   */
 	void Remove(SceneID stateID);
 
+	/**
+	 * @brief Asks the game to exit once the current frame is finished.
+	 *
+	 * Scenes must not close the window themselves: the render thread may be drawing on it.
+	 */
+	inline void RequestQuit() { m_IsQuitRequested = true; }
+
+	/**
+	 * @brief Checks whether a scene asked the game to exit.
+	 *
+	 * @return True once RequestQuit() was called.
+	 */
+	inline bool IsQuitRequested() const { return m_IsQuitRequested; }
+
 	/**
 	 * @brief Prints all currently stored scene IDs.
 	 *
@@ -184,6 +251,15 @@ public:
 	}
 
 private:
+	/**
+	 * @brief Adds a new scene to the manager and reports its size.
+	 *
+	 * @param pushingState A shared pointer to the scene to be added.
+	 * @param allocationID The ID used to reference this scene.
+	 * @param sceneBytes The size of the scene object.
+	 */
+	void AddScene(std::shared_ptr<IGameScene> pushingState, SceneID allocationID, std::size_t sceneBytes);
+
 	/**
 	 * @brief Validates that a SceneID is not already in use.
 	 *
@@ -196,6 +272,8 @@ private:
 private:
 	std::unordered_map<SceneID, std::shared_ptr<IGameScene>> m_States;  ///< All registered scenes
 	std::shared_ptr<IGameScene> m_Current;                              ///< The currently active scene
+	std::unordered_map<SceneID, TrackedMemory> m_SceneMemory;           ///< Size of every registered scene, reported as scene
 	int m_CurrentID;                                                    ///< ID of the active scene
+	bool m_IsQuitRequested = false;                                     ///< Set by RequestQuit()
 };
 
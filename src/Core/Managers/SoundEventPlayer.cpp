@@ -0,0 +1,38 @@
+#include "stdafx.h"
+#include "SoundEventPlayer.h"
+
+// ********************* SOUND EVENT CONSTANTS ********************
+constexpr float ENEMY_KILLED_INTERVAL = 0.05f;  // Seconds between two death sounds
+constexpr float PLAYER_HIT_INTERVAL = 0.0f;     // Every hit is heard
+constexpr float SHOT_FIRED_INTERVAL = 0.04f;    // Seconds between two shot sounds
+// ****************************************************
+
+SoundEventPlayer::SoundEventPlayer()
+{
+	m_Rules[static_cast<std::size_t>(GameEventType::ENEMY_KILLED)] = { SoundID::COW_DEATH, ENEMY_KILLED_INTERVAL };
+	m_Rules[static_cast<std::size_t>(GameEventType::PLAYER_HIT)] = { SoundID::SPACESHIP_HIT, PLAYER_HIT_INTERVAL };
+	m_Rules[static_cast<std::size_t>(GameEventType::SHOT_FIRED)] = { SoundID::SHOOT, SHOT_FIRED_INTERVAL };
+	Reset();
+}
+
+void SoundEventPlayer::Consume(const GameEventQueue& queue, float deltaTime)
+{
+	for (std::size_t type = 0; type < EVENT_TYPE_COUNT; ++type)
+	{
+		m_TimeSinceLastPlay[type] += deltaTime;
+
+		// However many events of this type the frame had, they make one sound
+		if (queue.GetCount(static_cast<GameEventType>(type)) == 0 || m_TimeSinceLastPlay[type] < m_Rules[type].minInterval)
+		{
+			continue;
+		}
+
+		SoundManager::Get().PlaySound(m_Rules[type].sound);
+		m_TimeSinceLastPlay[type] = 0.0f;
+	}
+}
+
+void SoundEventPlayer::Reset()
+{
+	m_TimeSinceLastPlay.fill(std::numeric_limits<float>::max());
+}
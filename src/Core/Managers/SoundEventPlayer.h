@@ -0,0 +1,59 @@
+/*!
+ * \file SoundEventPlayer.h
+ *
+ * \brief Contains the SoundEventPlayer class, which turns a frame's gameplay events into sound effects.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "Core/Managers/GameEventQueue.h"
+#include "Core/Managers/SoundManager.h"
+
+/**
+ * @class SoundEventPlayer
+ * @brief Plays the sound of every event type that happened during a frame, coalesced and rate limited.
+ *
+ * All events of one type in the same frame trigger a single sound (ten enemies killed by one volley are one death
+ * sound, not ten), and every type has a minimum interval between two of its sounds, so holding the trigger or a
+ * chain of kills cannot flood the voice pool.
+ */
+class SoundEventPlayer
+{
+public:
+	/**
+	 * @brief Constructs the player with every rate limit elapsed.
+	 */
+	SoundEventPlayer();
+
+	/**
+	 * @brief Plays the sounds for the events of the frame.
+	 *
+	 * @param queue The events pushed during the frame.
+	 * @param deltaTime The real duration of the frame, in seconds.
+	 */
+	void Consume(const GameEventQueue& queue, float deltaTime);
+
+	/**
+	 * @brief Forgets the time of the last sounds, so the next event of every type is heard.
+	 */
+	void Reset();
+
+private:
+	/**
+	 * @struct SoundRule
+	 * @brief How one event type sounds.
+	 */
+	struct SoundRule
+	{
+		SoundID sound;      ///< The sound played for the event
+		float minInterval;  ///< Minimum time between two plays, in seconds
+	};
+
+private:
+	static constexpr std::size_t EVENT_TYPE_COUNT = static_cast<std::size_t>(GameEventType::COUNT);
+
+	std::array<SoundRule, EVENT_TYPE_COUNT> m_Rules;         ///< Rule of every event type, indexed by GameEventType
+	std::array<float, EVENT_TYPE_COUNT> m_TimeSinceLastPlay; ///< Seconds since each type last played a sound
+};
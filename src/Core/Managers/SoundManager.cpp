@@ -1,65 +1,147 @@
 #include "stdafx.h"
 #include "SoundManager.h"
+#include "ResourceCache.h"
 
-static SoundManager g_SoundManager;
-
-SoundManager::SoundManager() = default;
-
-SoundManager::~SoundManager()
+SoundManager::SoundManager()
+	: m_PlayCounter(0)
 {
-	// Destructor is empty because sf::Sound automatically cleans up when it goes out of scope
 }
 
-bool SoundManager::LoadSound(const std::string& soundName, const std::string& filePath)
+bool SoundManager::LoadSound(SoundID soundID, const std::string& filePath, int maxInstances /*= 4*/, int priority /*= 0*/)
 {
+#ifdef MOO_HEADLESS
+	// Null audio: headless builds never open the audio device
+	(void)soundID;
+	(void)filePath;
+	(void)maxInstances;
+	(void)priority;
+	return true;
+#else
 	// Check if sound is already loaded
-	if (m_SoundBuffers.find(soundName) != m_SoundBuffers.end())
+	SoundSlot& slot = m_Slots[static_cast<std::size_t>(soundID)];
+	if (slot.buffer != nullptr)
 	{
 		return true;  // Sound already loaded
 	}
 
-	sf::SoundBuffer buffer;
-	if (!buffer.loadFromFile(filePath))
+	// Buffers are shared through the cache, so the samples are decoded once whoever loads them
+	std::shared_ptr<sf::SoundBuffer> buffer = ResourceCache::Get().GetSoundBuffer(filePath);
+	if (buffer == nullptr)
 	{
-		std::cerr << "Failed to load sound from " << filePath << std::endl;
+		Log::Print("Failed to load sound", filePath, LogLevel::ERROR_);
 		return false;  // Loading sound failed
 	}
 
-	// Store the sound buffer
-	m_SoundBuffers[soundName] = buffer;
+	slot.buffer = buffer;
+	slot.firstVoice = m_Voices.size();
+	slot.voiceCount = static_cast<std::size_t>(std::max(1, maxInstances));
+	slot.priority = priority;
 
-	// Create the sound instance using the loaded buffer
-	sf::Sound sound;
-	sound.setBuffer(m_SoundBuffers[soundName]);
-
-	// Store the sound instance
-	m_Sounds[soundName] = sound;
+	// Bind the voices now: attaching a buffer allocates, playing an attached voice does not
+	m_Voices.resize(slot.firstVoice + slot.voiceCount);
+	for (std::size_t i = slot.firstVoice; i < m_Voices.size(); ++i)
+	{
+		m_Voices[i].sound.setBuffer(*buffer);
+		m_Voices[i].priority = priority;
+	}
 
 	return true;  // Successfully loaded sound
+#endif
 }
 
-void SoundManager::PlaySound(const std::string& soundName)
+bool SoundManager::PlaySound(SoundID soundID)
 {
-	// Find sound by name
-	if (m_Sounds.find(soundName) != m_Sounds.end())
+#ifdef MOO_HEADLESS
+	(void)soundID;
+	return false;
+#else
+	const SoundSlot& slot = m_Slots[static_cast<std::size_t>(soundID)];
+	if (slot.buffer == nullptr)
 	{
-		m_Sounds[soundName].play();  // Play the sound
+		return false;
+	}
+
+	// A free voice of this sound, or else its oldest one, which simply restarts
+	std::size_t voiceIndex = slot.firstVoice;
+	bool isFree = false;
+	for (std::size_t i = slot.firstVoice; i < slot.firstVoice + slot.voiceCount; ++i)
+	{
+		if (m_Voices[i].sound.getStatus() != sf::Sound::Playing)
+		{
+			voiceIndex = i;
+			isFree = true;
+			break;
+		}
+
+		if (m_Voices[i].startOrder < m_Voices[voiceIndex].startOrder)
+		{
+			voiceIndex = i;
+		}
+	}
+
+	// Starting a free voice adds one to the mix: make room if the mix is full
+	if (isFree && GetPlayingVoiceCount() >= MAX_PLAYING_VOICES)
+	{
+		const int victim = FindVoiceToSteal(slot.priority);
+		if (victim < 0)
+		{
+			return false;  // Everything playing matters more than this sound
+		}
+
+		m_Voices[victim].sound.stop();
 	}
-	else
+
+	Voice& voice = m_Voices[voiceIndex];
+	voice.startOrder = ++m_PlayCounter;
+	voice.sound.stop();
+	voice.sound.play();
+	return true;
+#endif
+}
+
+void SoundManager::StopSound(SoundID soundID)
+{
+	const SoundSlot& slot = m_Slots[static_cast<std::size_t>(soundID)];
+	for (std::size_t i = slot.firstVoice; i < slot.firstVoice + slot.voiceCount; ++i)
 	{
-		std::cerr << "Sound not found: " << soundName << std::endl;
+		m_Voices[i].sound.stop();
 	}
 }
 
-void SoundManager::StopSound(const std::string& soundName)
+void SoundManager::StopAll()
 {
-	// Find sound by name
-	if (m_Sounds.find(soundName) != m_Sounds.end())
+	for (Voice& voice : m_Voices)
 	{
-		m_Sounds[soundName].stop();  // Stop the sound
+		voice.sound.stop();
 	}
-	else
+}
+
+std::size_t SoundManager::GetPlayingVoiceCount() const
+{
+	return static_cast<std::size_t>(std::count_if(m_Voices.begin(), m_Voices.end(), [](const Voice& voice)
+		{
+			return voice.sound.getStatus() == sf::Sound::Playing;
+		}));
+}
+
+int SoundManager::FindVoiceToSteal(int priority) const
+{
+	int victim = -1;
+	for (std::size_t i = 0; i < m_Voices.size(); ++i)
 	{
-		std::cerr << "Sound not found: " << soundName << std::endl;
+		const Voice& voice = m_Voices[i];
+		if (voice.sound.getStatus() != sf::Sound::Playing || voice.priority > priority)
+		{
+			continue;
+		}
+
+		// Lowest priority first, the oldest among equals
+		if (victim < 0 || voice.priority < m_Voices[victim].priority
+			|| (voice.priority == m_Voices[victim].priority && voice.startOrder < m_Voices[victim].startOrder))
+		{
+			victim = static_cast<int>(i);
+		}
 	}
-}
\ No newline at end of file
+
+	return victim;
+}
@@ -1,15 +1,16 @@
-
 /*!
  * \file SoundManager.h
  *
- * \brief Declares the SoundManager class used to load and manage sound effects.
+ * \brief Declares the SoundID enum and the SoundManager singleton, the game's single audio engine for sound effects.
  *
  * The SoundManager is responsible for handling short, non-streamed sound effects
- * using SFMLs sf::Sound and sf::SoundBuffer. It allows for sounds to be loaded,
- * played, and stopped using string identifiers.
+ * using SFML's sf::Sound and sf::SoundBuffer. Every sound gets a small pool of voices when it is loaded, so the same
+ * effect can overlap itself (rapid fire) instead of restarting, and a global voice limit keeps the mix readable by
+ * stealing the least important voice when too many effects play at once.
  *
  * This system is designed for in-game sound effects like attacks, footsteps, UI clicks, etc.
  * Music streaming should be handled separately via sf::Music.
+ * Headless builds (MOO_HEADLESS) compile the manager as a null sink that never touches the audio device.
  *
  * \author Felix Atanasescu - HE20830
  * \date April 2025
@@ -17,61 +18,132 @@
 
 #pragma once
 
+/**
+ * @enum SoundID
+ * @brief Identifies every sound effect of the game.
+ *
+ * Sounds are looked up by index, so playing one costs no string hashing or comparison.
+ */
+enum class SoundID
+{
+	COW_DEATH = 0,  ///< An enemy is killed
+	SHOOT,          ///< The spaceship fires
+	SPACESHIP_HIT,  ///< The spaceship is hit by an enemy projectile
+	COUNT           ///< Number of sound effects, not a sound
+};
+
  /**
   * @class SoundManager
-  * @brief Manages one-shot sound effects in the game.
+  * @brief Singleton playing one-shot sound effects from a fixed pool of voices.
   *
-  * Handles the loading and playback of short sounds via string keys.
-  * Sounds must be loaded before they can be played.
-  *
-  * Features:
-  * - Load sound effects from disk
-  * - Play a sound on demand
-  * - Stop a currently playing sound
+  * Each sound is loaded once with the number of copies of it that may play at the same time and a priority. Its
+  * voices are created and bound to its buffer at load time, so PlaySound() never allocates:
+  * - a free voice of the sound plays it
+  * - if every voice of the sound is busy, its oldest one restarts
+  * - if MAX_PLAYING_VOICES are already playing, the lowest priority (then oldest) voice is stopped first, unless it
+  *   matters more than the new sound, in which case the new sound is dropped
   */
 class SoundManager
 {
 public:
-	/**
-	* @brief Constructs the SoundManager.
-	*/
-	SoundManager();
+	static constexpr std::size_t MAX_PLAYING_VOICES = 16; ///< Voices allowed to play at the same time, all sounds together
 
 	/**
-	 * @brief Destroys the SoundManager and frees any loaded resources.
+	 * @brief Retrieves the singleton instance of the SoundManager.
+	 *
+	 * @return Reference to the global SoundManager instance.
 	 */
-	~SoundManager();
+	static SoundManager& Get()
+	{
+		static SoundManager instance;
+		return instance;
+	}
 
 	/**
-	 * @brief Loads a sound file into memory and stores it under a name.
+	 * @brief Loads a sound and creates its voices.
 	 *
-	 * If the sound was previously loaded, it will be overwritten.
+	 * Loading a sound that is already loaded does nothing, so every user of a sound can load it safely.
 	 *
-	 * @param soundName A unique identifier for the sound.
+	 * @param soundID The sound to load.
 	 * @param filePath The path to the audio file to load (e.g., "assets/sound.wav").
-	 * @return True if the sound loaded successfully, false otherwise.
+	 * @param maxInstances The number of copies of the sound that may play at the same time.
+	 * @param priority How important the sound is when voices must be stolen; higher wins.
+	 * @return True if the sound is loaded, false otherwise.
 	 */
-	bool LoadSound(const std::string& soundName, const std::string& filePath);
+	bool LoadSound(SoundID soundID, const std::string& filePath, int maxInstances = 4, int priority = 0);
 
 	/**
-	 * @brief Plays the sound associated with the given name.
+	 * @brief Plays a sound on one of its voices.
 	 *
-	 * If the sound is not loaded, nothing will happen.
+	 * Does nothing if the sound is not loaded. Never allocates.
+	 *
+	 * @param soundID The sound to play.
+	 * @return True if the sound started, false if it was not loaded or every voice was taken by more important sounds.
+	 */
+	bool PlaySound(SoundID soundID);
+
+	/**
+	 * @brief Stops every voice playing the given sound.
 	 *
-	 * @param soundName The identifier of the sound to play.
+	 * @param soundID The sound to stop.
+	 */
+	void StopSound(SoundID soundID);
+
+	/**
+	 * @brief Stops every voice.
 	 */
-	void PlaySound(const std::string& soundName);
+	void StopAll();
 
 	/**
-	 * @brief Stops playback of the sound associated with the given name.
+	 * @brief Gets the number of voices currently playing.
 	 *
-	 * Has no effect if the sound is not currently playing or not loaded.
+	 * @return The playing voice count.
+	 */
+	std::size_t GetPlayingVoiceCount() const;
+
+private:
+	/**
+	 * @brief Private constructor to enforce singleton pattern.
+	 */
+	SoundManager();
+
+	// Deleted copy constructor and assignment operator
+	SoundManager(const SoundManager&) = delete;
+	SoundManager& operator=(const SoundManager&) = delete;
+
+	/**
+	 * @brief Finds the voice that a new play should stop when the voice limit is reached.
 	 *
-	 * @param soundName The identifier of the sound to stop.
+	 * @param priority The priority of the sound about to play.
+	 * @return The index of the lowest priority, oldest playing voice, or -1 if every playing voice matters more.
+	 */
+	int FindVoiceToSteal(int priority) const;
+
+	/**
+	 * @struct Voice
+	 * @brief One sf::Sound permanently bound to the buffer of one sound.
+	 */
+	struct Voice
+	{
+		sf::Sound sound;         ///< The playable instance
+		int priority = 0;        ///< Priority of the sound the voice belongs to
+		uint64_t startOrder = 0; ///< Value of the play counter when it last started, to find the oldest voice
+	};
+
+	/**
+	 * @struct SoundSlot
+	 * @brief A loaded sound and the range of voices it owns.
 	 */
-	void StopSound(const std::string& soundName);
+	struct SoundSlot
+	{
+		std::shared_ptr<sf::SoundBuffer> buffer; ///< Decoded samples, shared through the ResourceCache
+		std::size_t firstVoice = 0;              ///< Index of the sound's first voice
+		std::size_t voiceCount = 0;              ///< Number of voices, the sound's instance limit
+		int priority = 0;                        ///< Importance when stealing voices
+	};
 
 private:
-	std::map<std::string, sf::SoundBuffer> m_SoundBuffers; ///< Maps sound names to their loaded audio data
-	std::map<std::string, sf::Sound> m_Sounds;             ///< Maps sound names to their playable sf::Sound instances
+	std::array<SoundSlot, static_cast<std::size_t>(SoundID::COUNT)> m_Slots; ///< Every sound, indexed by SoundID
+	std::vector<Voice> m_Voices;                                             ///< Voices of every sound, grouped by sound
+	uint64_t m_PlayCounter;                                                  ///< Incremented by every play
 };
@@ -0,0 +1,121 @@
+#include "stdafx.h"
+#include "AllocationCounter.h"
+
+#ifdef MOO_COUNT_ALLOCATIONS
+#include <cassert>
+#include <cstdlib>
+
+namespace
+{
+	thread_local int t_ScopeDepth = 0;                   // Counting scopes open on this thread
+	std::atomic<std::size_t> s_FrameAllocations{ 0 };    // Allocations counted this frame, on every thread
+
+	std::size_t s_LastFrameAllocations = 0;          // Count of the previous frame, main thread
+	int s_AllocatingFrames = 0;                      // Frames in a row that allocated, main thread
+
+	/**
+	 * @brief Counts one allocation if the current thread is inside a counting scope.
+	 */
+	inline void CountAllocation()
+	{
+		if (t_ScopeDepth > 0)
+		{
+			s_FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Allocates aligned memory from the C runtime, which the replaced operators sit on.
+	 */
+	void* AlignedMalloc(std::size_t size, std::size_t alignment)
+	{
+#ifdef _WIN32
+		return _aligned_malloc(size, alignment);
+#else
+		// aligned_alloc wants a size that is a multiple of the alignment
+		return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+	}
+
+	/**
+	 * @brief Frees memory from AlignedMalloc().
+	 */
+	void AlignedFree(void* memory)
+	{
+#ifdef _WIN32
+		_aligned_free(memory);
+#else
+		std::free(memory);
+#endif
+	}
+}
+
+AllocationCounter::Scope::Scope()
+{
+	++t_ScopeDepth;
+}
+
+AllocationCounter::Scope::~Scope()
+{
+	--t_ScopeDepth;
+}
+
+void AllocationCounter::EndFrame()
+{
+	s_LastFrameAllocations = s_FrameAllocations.exchange(0, std::memory_order_relaxed);
+
+	s_AllocatingFrames = (s_LastFrameAllocations > 0) ? s_AllocatingFrames + 1 : 0;
+	if (s_AllocatingFrames == STEADY_STATE_FRAMES)
+	{
+		Log::Print("The frame loop allocates every frame, allocations in the last frame", s_LastFrameAllocations, LogLevel::ERROR_);
+		assert(false && "Steady-state frames must not allocate, see AllocationCounter");
+	}
+}
+
+std::size_t AllocationCounter::GetLastFrameAllocations()
+{
+	return s_LastFrameAllocations;
+}
+
+// The array and nothrow forms of the standard library forward to these, so every allocation passes here
+
+void* operator new(std::size_t size)
+{
+	CountAllocation();
+	if (void* memory = std::malloc(size == 0 ? 1 : size))
+	{
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	CountAllocation();
+	if (void* memory = AlignedMalloc(size == 0 ? 1 : size, static_cast<std::size_t>(alignment)))
+	{
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+	AlignedFree(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+	AlignedFree(memory);
+}
+#endif
@@ -0,0 +1,83 @@
+/*!
+ * \file AllocationCounter.h
+ *
+ * \brief Contains the AllocationCounter class, a debug check that the game loop does not touch the heap once it has
+ * settled.
+ *
+ * A heap allocation costs far more than it looks, takes a lock shared with every thread, and a few per frame are
+ * enough to fragment memory over a long session. When MOO_COUNT_ALLOCATIONS is defined (Debug builds) the global
+ * operator new is replaced by one that counts the allocations made inside a counting Scope; GameInstance opens one
+ * around its ticks and the scene recording, and the JobSystem workers open one around every job they run, so the
+ * frame's work is counted on whichever thread it lands. The asset loader and the render thread are not counted.
+ * Without the define every call compiles to nothing.
+ *
+ * The check is a steady-state check, not a zero-per-frame assertion: a frame may allocate, and it only asserts once
+ * STEADY_STATE_FRAMES frames in a row have allocated.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @class AllocationCounter
+ * @brief Counts the heap allocations made in counting scopes, on any thread, frame by frame.
+ *
+ * A frame may allocate: scenes switch, containers grow to their working size. What must not happen is a frame loop
+ * that allocates every frame, so EndFrame() only complains after STEADY_STATE_FRAMES allocating frames in a row.
+ */
+class AllocationCounter
+{
+public:
+	static constexpr int STEADY_STATE_FRAMES = 120; ///< Allocating frames in a row tolerated before the check fails
+
+#ifdef MOO_COUNT_ALLOCATIONS
+	static constexpr bool IS_ENABLED = true;        ///< Whether allocations are counted in this build
+#else
+	static constexpr bool IS_ENABLED = false;       ///< Whether allocations are counted in this build
+#endif
+
+	/**
+	 * @class Scope
+	 * @brief Counts the allocations of the current thread while alive, into the frame's shared count.
+	 */
+	class Scope
+	{
+	public:
+		/**
+		 * @brief Starts counting on the current thread.
+		 */
+		Scope();
+
+		/**
+		 * @brief Stops counting on the current thread.
+		 */
+		~Scope();
+
+		// Deleted copy constructor and assignment operator
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+	};
+
+	/**
+	 * @brief Ends the frame: publishes its count and checks that allocating frames do not go on forever.
+	 *
+	 * Called by GameInstance once per frame, on the main thread.
+	 */
+	static void EndFrame();
+
+	/**
+	 * @brief Gets the number of allocations counted during the previous frame.
+	 *
+	 * @return The allocation count, always 0 when counting is compiled out.
+	 */
+	static std::size_t GetLastFrameAllocations();
+};
+
+#ifndef MOO_COUNT_ALLOCATIONS
+inline AllocationCounter::Scope::Scope() {}
+inline AllocationCounter::Scope::~Scope() {}
+inline void AllocationCounter::EndFrame() {}
+inline std::size_t AllocationCounter::GetLastFrameAllocations() { return 0; }
+#endif
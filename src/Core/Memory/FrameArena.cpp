@@ -0,0 +1,86 @@
+#include "stdafx.h"
+#include "FrameArena.h"
+
+// ********************* FRAME ARENA CONSTANTS ********************
+constexpr std::size_t OVERFLOW_BLOCK_RESERVE = 64; // Overflow allocations tracked without reallocating the list
+// ****************************************************
+
+FrameArena::FrameArena()
+	: m_Buffer(std::make_unique<std::byte[]>(DEFAULT_CAPACITY))
+	, m_Capacity(DEFAULT_CAPACITY)
+	, m_Offset(0)
+	, m_OverflowBytes(0)
+	, m_Peak(0)
+{
+	m_Overflow.reserve(OVERFLOW_BLOCK_RESERVE);
+}
+
+FrameArena::~FrameArena()
+{
+	ReleaseOverflow();
+}
+
+void* FrameArena::Allocate(std::size_t size, std::size_t alignment /*= alignof(std::max_align_t)*/)
+{
+	// Align the address, not just the offset, the block itself is only aligned for std::byte
+	const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_Buffer.get());
+	std::size_t offset = m_Offset.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		const std::uintptr_t aligned = (base + offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+		const std::size_t newOffset = static_cast<std::size_t>(aligned - base) + size;
+		if (newOffset > m_Capacity)
+		{
+			return AllocateOverflow(size, alignment);
+		}
+
+		// Another job may have bumped the offset since it was read; retry from its value
+		if (m_Offset.compare_exchange_weak(offset, newOffset, std::memory_order_relaxed))
+		{
+			return reinterpret_cast<void*>(aligned);
+		}
+	}
+}
+
+void FrameArena::Reset()
+{
+	const std::size_t used = GetUsed();
+	m_Peak = std::max(m_Peak, used);
+
+	// Grow once so the next frame this busy fits in the block
+	if (m_OverflowBytes > 0)
+	{
+		std::size_t newCapacity = m_Capacity;
+		while (newCapacity < used)
+		{
+			newCapacity *= 2;
+		}
+
+		Log::Print("Frame arena overflowed, growing it to bytes", newCapacity, LogLevel::WARNING);
+		m_Buffer = std::make_unique<std::byte[]>(newCapacity);
+		m_Capacity = newCapacity;
+	}
+
+	ReleaseOverflow();
+	m_Offset.store(0, std::memory_order_relaxed);
+}
+
+void* FrameArena::AllocateOverflow(std::size_t size, std::size_t alignment)
+{
+	void* memory = ::operator new(size, std::align_val_t(alignment));
+
+	std::lock_guard<std::mutex> lock(m_OverflowMutex);
+	m_Overflow.push_back({ memory, alignment });
+	m_OverflowBytes += size;
+	return memory;
+}
+
+void FrameArena::ReleaseOverflow()
+{
+	for (const OverflowBlock& block : m_Overflow)
+	{
+		::operator delete(block.memory, std::align_val_t(block.alignment));
+	}
+	m_Overflow.clear();
+	m_OverflowBytes = 0;
+}
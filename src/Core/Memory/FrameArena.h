@@ -0,0 +1,186 @@
+/*!
+ * \file FrameArena.h
+ *
+ * \brief Contains the FrameArena class, a linear allocator emptied once per frame, and the FrameAllocator,
+ * FrameVector and FrameString types that keep scratch data in it.
+ *
+ * Scratch data that only lives for one frame (the shot-roll batches of the enemy jobs, the write cursors of the
+ * broadphase build, reports formatted on a scene switch) does not need the general-purpose heap: the arena hands out
+ * memory by bumping an offset in one pre-allocated block, and GameInstance gives all of it back at once at the end of
+ * the frame by resetting the offset. Allocating costs one atomic compare-exchange, freeing costs nothing, and the heap
+ * stays untouched in steady state.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @class FrameArena
+ * @brief Singleton bump allocator reset at the end of every frame.
+ *
+ * The main thread and the JobSystem workers running the frame's jobs may allocate concurrently. Threads that live
+ * across frames (the asset loader, the render thread) must not: Reset() runs on the main thread once the frame's jobs
+ * have finished and reuses the memory for the next frame, so nothing from the arena may be kept past the end of the
+ * frame either. When a frame needs more than the block holds, the excess comes from the heap and the block grows at the
+ * next Reset(), so the arena settles at the size the game actually needs.
+ */
+class FrameArena
+{
+public:
+	static constexpr std::size_t DEFAULT_CAPACITY = 256 * 1024; ///< Initial size of the block, in bytes
+
+	/**
+	 * @brief Retrieves the singleton instance of the FrameArena.
+	 *
+	 * @return Reference to the global FrameArena instance.
+	 */
+	static FrameArena& Get()
+	{
+		static FrameArena instance;
+		return instance;
+	}
+
+	/**
+	 * @brief Allocates memory that stays valid until the next Reset(). Safe to call from the frame's jobs.
+	 *
+	 * @param size The number of bytes.
+	 * @param alignment The alignment of the memory, a power of two.
+	 * @return The memory, never nullptr.
+	 */
+	void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+	/**
+	 * @brief Allocates an uninitialised array that stays valid until the next Reset().
+	 *
+	 * @tparam T A trivially destructible type; destructors of arena memory are never run.
+	 * @param count The number of elements.
+	 * @return The first element.
+	 */
+	template <typename T>
+	T* AllocateArray(std::size_t count)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "Arena memory is never destroyed");
+		return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	/**
+	 * @brief Releases everything allocated this frame, and grows the block if the frame overflowed it.
+	 *
+	 * Called by GameInstance at the end of every frame, on the main thread, while no job is running.
+	 */
+	void Reset();
+
+	// Getters
+
+	/**
+	 * @brief Gets the number of bytes allocated since the last Reset().
+	 *
+	 * @return The bytes used this frame, overflow included.
+	 */
+	inline std::size_t GetUsed() const { return m_Offset.load(std::memory_order_relaxed) + m_OverflowBytes; }
+
+	/**
+	 * @brief Gets the most bytes a single frame used.
+	 *
+	 * @return The peak usage, in bytes.
+	 */
+	inline std::size_t GetPeak() const { return m_Peak; }
+
+	/**
+	 * @brief Gets the size of the block.
+	 *
+	 * @return The capacity, in bytes.
+	 */
+	inline std::size_t GetCapacity() const { return m_Capacity; }
+
+private:
+	/**
+	 * @brief Private constructor to enforce singleton pattern; allocates the block.
+	 */
+	FrameArena();
+
+	/**
+	 * @brief Frees the overflow allocations still held.
+	 */
+	~FrameArena();
+
+	// Deleted copy constructor and assignment operator
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+
+	/**
+	 * @brief Allocates memory the block has no room for from the heap, freed at the next Reset(). Thread-safe.
+	 *
+	 * @param size The number of bytes.
+	 * @param alignment The alignment of the memory.
+	 * @return The memory.
+	 */
+	void* AllocateOverflow(std::size_t size, std::size_t alignment);
+
+	/**
+	 * @brief Frees every overflow allocation.
+	 */
+	void ReleaseOverflow();
+
+private:
+	/**
+	 * @struct OverflowBlock
+	 * @brief Heap memory handed out because the block was full.
+	 */
+	struct OverflowBlock
+	{
+		void* memory;           ///< The allocation
+		std::size_t alignment;  ///< The alignment it was made with, needed to free it
+	};
+
+	std::unique_ptr<std::byte[]> m_Buffer;    ///< The block memory is handed out from
+	std::size_t m_Capacity;                   ///< The size of the block, in bytes
+	std::atomic<std::size_t> m_Offset;        ///< Bytes of the block used this frame, bumped by every thread
+	std::size_t m_OverflowBytes;              ///< Bytes taken from the heap this frame, guarded by m_OverflowMutex
+	std::size_t m_Peak;                       ///< The most bytes a frame used
+	std::vector<OverflowBlock> m_Overflow;    ///< Heap allocations to free at the next Reset(), guarded by m_OverflowMutex
+	std::mutex m_OverflowMutex;               ///< Serialises the overflow path, which is rare and already slow
+};
+
+/**
+ * @class FrameAllocator
+ * @brief Standard allocator taking its memory from the FrameArena.
+ *
+ * Deallocation does nothing, the memory comes back with the arena's Reset(). Containers using it must be destroyed
+ * (or at least no longer touched) before the end of the frame.
+ *
+ * @tparam T The type of the allocated elements.
+ */
+template <typename T>
+class FrameAllocator
+{
+public:
+	using value_type = T;
+
+	FrameAllocator() noexcept = default;
+
+	template <typename U>
+	FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+	T* allocate(std::size_t count)
+	{
+		return static_cast<T*>(FrameArena::Get().Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, std::size_t) noexcept {}
+
+	template <typename U>
+	bool operator==(const FrameAllocator<U>&) const noexcept { return true; }
+
+	template <typename U>
+	bool operator!=(const FrameAllocator<U>&) const noexcept { return false; }
+};
+
+/// Vector whose storage lives in the FrameArena, for scratch lists of one frame
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+/// String whose storage lives in the FrameArena, for text formatted during one frame
+using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;
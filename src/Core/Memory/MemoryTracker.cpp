@@ -0,0 +1,215 @@
+#include "stdafx.h"
+#include "MemoryTracker.h"
+#include "FrameArena.h"
+
+// ********************* MEMORY BUDGET CONSTANTS ********************
+constexpr std::size_t MEBIBYTE = 1024 * 1024;
+constexpr std::array<std::size_t, MEMORY_TAG_COUNT> DEFAULT_BUDGETS =
+{
+	256 * MEBIBYTE, // TEXTURES
+	64 * MEBIBYTE,  // AUDIO
+	32 * MEBIBYTE,  // ENTITIES
+	16 * MEBIBYTE,  // UI
+	16 * MEBIBYTE   // SCENE
+};
+// ****************************************************
+
+MemoryTracker::MemoryTracker()
+{
+	for (std::size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+	{
+		m_Stats[i].budgetBytes = DEFAULT_BUDGETS[i];
+	}
+}
+
+void MemoryTracker::Allocate(MemoryTag tag, std::size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	TagStats& stats = m_Stats[static_cast<std::size_t>(tag)];
+	stats.liveBytes += bytes;
+	stats.peakBytes = std::max(stats.peakBytes, stats.liveBytes);
+	++stats.frameAllocations;
+	++stats.totalAllocations;
+
+	// Warn once per crossing, not on every allocation while over
+	if (stats.budgetBytes > 0 && stats.liveBytes > stats.budgetBytes && !stats.isOverBudget)
+	{
+		stats.isOverBudget = true;
+		Log::Print(std::string("Memory budget exceeded, KiB held by ") + GetTagName(tag), stats.liveBytes / 1024, LogLevel::WARNING);
+	}
+}
+
+void MemoryTracker::Free(MemoryTag tag, std::size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	TagStats& stats = m_Stats[static_cast<std::size_t>(tag)];
+	stats.liveBytes -= std::min(bytes, stats.liveBytes);
+	if (stats.liveBytes <= stats.budgetBytes)
+	{
+		stats.isOverBudget = false;
+	}
+}
+
+void MemoryTracker::SetBudget(MemoryTag tag, std::size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	TagStats& stats = m_Stats[static_cast<std::size_t>(tag)];
+	stats.budgetBytes = bytes;
+	stats.isOverBudget = false;
+}
+
+bool MemoryTracker::ParseBudget(const std::string& option)
+{
+	const std::size_t colon = option.find(':');
+	if (colon == std::string::npos)
+	{
+		return false;
+	}
+
+	const std::string name = option.substr(0, colon);
+	std::size_t mebibytes = 0;
+	std::istringstream stream(option.substr(colon + 1));
+	stream >> mebibytes;
+	if (stream.fail() || !stream.eof())
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+	{
+		const MemoryTag tag = static_cast<MemoryTag>(i);
+		if (name == GetTagName(tag))
+		{
+			SetBudget(tag, mebibytes * MEBIBYTE);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void MemoryTracker::EndFrame()
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	for (TagStats& stats : m_Stats)
+	{
+		stats.lastFrameAllocations = stats.frameAllocations;
+		stats.maxFrameAllocations = std::max(stats.maxFrameAllocations, stats.frameAllocations);
+		stats.frameAllocations = 0;
+	}
+}
+
+void MemoryTracker::Report(std::string_view reason)
+{
+	FrameString report;
+	report.append("Memory report (").append(reason).append(")\n");
+
+	char line[160];
+	std::snprintf(line, sizeof(line), "  %-9s %10s %10s %10s %12s %12s %8s\n",
+		"tag", "live KiB", "peak KiB", "budget KiB", "allocs/frame", "max/frame", "allocs");
+	report.append(line);
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		std::size_t totalLive = 0;
+		std::size_t totalPeak = 0;
+		for (std::size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+		{
+			const TagStats& stats = m_Stats[i];
+			std::snprintf(line, sizeof(line), "  %-9s %10zu %10zu %10zu %12zu %12zu %8zu%s\n",
+				GetTagName(static_cast<MemoryTag>(i)),
+				stats.liveBytes / 1024, stats.peakBytes / 1024, stats.budgetBytes / 1024,
+				stats.lastFrameAllocations, stats.maxFrameAllocations, stats.totalAllocations,
+				stats.isOverBudget ? "  OVER BUDGET" : "");
+			report.append(line);
+
+			totalLive += stats.liveBytes;
+			totalPeak += stats.peakBytes;
+		}
+
+		std::snprintf(line, sizeof(line), "  %-9s %10zu %10zu\n", "total", totalLive / 1024, totalPeak / 1024);
+		report.append(line);
+	}
+
+	Log::Print(report);
+
+	if (m_ReportFile.empty())
+	{
+		return;
+	}
+
+	std::ofstream file(m_ReportFile, std::ios::app);
+	if (!file)
+	{
+		Log::Print("Failed to write memory report", m_ReportFile, LogLevel::ERROR_);
+		return;
+	}
+	file << report << '\n';
+}
+
+void MemoryTracker::SetReportFile(const std::string& path)
+{
+	m_ReportFile = path;
+	if (!m_ReportFile.empty())
+	{
+		// One run per file, earlier runs would make the peaks misleading
+		std::ofstream file(m_ReportFile, std::ios::trunc);
+	}
+}
+
+std::size_t MemoryTracker::GetLiveBytes(MemoryTag tag) const
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_Stats[static_cast<std::size_t>(tag)].liveBytes;
+}
+
+std::size_t MemoryTracker::GetPeakBytes(MemoryTag tag) const
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_Stats[static_cast<std::size_t>(tag)].peakBytes;
+}
+
+std::size_t MemoryTracker::GetLastFrameAllocations(MemoryTag tag) const
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_Stats[static_cast<std::size_t>(tag)].lastFrameAllocations;
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag)
+{
+	switch (tag)
+	{
+	case MemoryTag::TEXTURES: return "textures";
+	case MemoryTag::AUDIO: return "audio";
+	case MemoryTag::ENTITIES: return "entities";
+	case MemoryTag::UI: return "ui";
+	case MemoryTag::SCENE: return "scene";
+	default: return "unknown";
+	}
+}
+
+TrackedMemory::TrackedMemory(MemoryTag tag)
+	: m_Tag(tag)
+	, m_Bytes(0)
+{
+	// Owners can be singletons too; constructing the tracker first makes sure it is destroyed after them
+	MemoryTracker::Get();
+}
+
+TrackedMemory::~TrackedMemory()
+{
+	Resize(0);
+}
+
+void TrackedMemory::Resize(std::size_t bytes)
+{
+	if (bytes > m_Bytes)
+	{
+		MemoryTracker::Get().Allocate(m_Tag, bytes - m_Bytes);
+	}
+	else if (bytes < m_Bytes)
+	{
+		MemoryTracker::Get().Free(m_Tag, m_Bytes - bytes);
+	}
+	m_Bytes = bytes;
+}
@@ -0,0 +1,221 @@
+/*!
+ * \file MemoryTracker.h
+ *
+ * \brief Contains the MemoryTracker singleton, which accounts the memory each part of the game holds, and the
+ * TrackedMemory handle its owners report through.
+ *
+ * Most of what the game holds never passes through operator new in a way worth counting: textures live in video
+ * memory, sound buffers and entity arrays are a few large blocks. So the owners of that memory report it themselves,
+ * under a tag, whenever the amount changes: the resource cache per loaded resource, the stores per capacity change.
+ * The tracker keeps live and peak bytes and the number of allocations per frame for each tag, warns when a tag goes
+ * over its budget, and writes a report on every scene switch and on exit.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @enum MemoryTag
+ * @brief The part of the game a block of memory belongs to.
+ */
+enum class MemoryTag : std::uint8_t
+{
+	TEXTURES, ///< Texture and atlas pages, in video memory
+	AUDIO,    ///< Decoded sound buffers
+	ENTITIES, ///< Enemy, projectile and collision storage
+	UI,       ///< Fonts, overlay and HUD geometry
+	SCENE     ///< Scene objects, wave data and recorded frames
+};
+
+constexpr std::size_t MEMORY_TAG_COUNT = 5;
+
+/**
+ * @class MemoryTracker
+ * @brief Thread-safe per-tag accounting of live bytes, peak bytes and allocations per frame.
+ *
+ * Every frame:
+ * - EndFrame() once, to publish the allocations counted during the frame
+ *
+ * Report() is called by the SceneManager on every switch and by GameInstance on exit.
+ */
+class MemoryTracker
+{
+public:
+	/**
+	 * @brief Retrieves the singleton instance of the MemoryTracker.
+	 *
+	 * @return Reference to the global MemoryTracker instance.
+	 */
+	static MemoryTracker& Get()
+	{
+		static MemoryTracker instance;
+		return instance;
+	}
+
+	/**
+	 * @brief Records memory taken under a tag, and warns if that put the tag over its budget.
+	 *
+	 * @param tag The part of the game that took it.
+	 * @param bytes The number of bytes.
+	 */
+	void Allocate(MemoryTag tag, std::size_t bytes);
+
+	/**
+	 * @brief Records memory given back under a tag.
+	 *
+	 * @param tag The part of the game that gave it back.
+	 * @param bytes The number of bytes, as passed to Allocate().
+	 */
+	void Free(MemoryTag tag, std::size_t bytes);
+
+	/**
+	 * @brief Sets the most memory a tag should hold before warnings are printed.
+	 *
+	 * @param tag The part of the game.
+	 * @param bytes The budget in bytes, 0 for none.
+	 */
+	void SetBudget(MemoryTag tag, std::size_t bytes);
+
+	/**
+	 * @brief Sets a budget from a "<tag>:<MiB>" option such as "textures:128".
+	 *
+	 * @param option The option text.
+	 * @return True if the option named a tag and a number.
+	 */
+	bool ParseBudget(const std::string& option);
+
+	/**
+	 * @brief Publishes the allocations counted during the frame that just ended and starts counting a new one.
+	 */
+	void EndFrame();
+
+	/**
+	 * @brief Prints the live, peak and budget of every tag, and appends the same table to the report file.
+	 *
+	 * The table is formatted in the FrameArena: a scene switch reports from inside a tick. Main thread only.
+	 *
+	 * @param reason Why the report is written, shown in its title.
+	 */
+	void Report(std::string_view reason);
+
+	/**
+	 * @brief Sets the file every report is appended to; the file is emptied first.
+	 *
+	 * @param path The path of the report file, empty to only print reports.
+	 */
+	void SetReportFile(const std::string& path);
+
+	// Getters
+
+	/**
+	 * @brief Gets the bytes a tag holds.
+	 *
+	 * @param tag The part of the game.
+	 * @return The live bytes.
+	 */
+	std::size_t GetLiveBytes(MemoryTag tag) const;
+
+	/**
+	 * @brief Gets the most bytes a tag ever held.
+	 *
+	 * @param tag The part of the game.
+	 * @return The peak bytes.
+	 */
+	std::size_t GetPeakBytes(MemoryTag tag) const;
+
+	/**
+	 * @brief Gets the allocations a tag made during the previous frame.
+	 *
+	 * @param tag The part of the game.
+	 * @return The allocation count.
+	 */
+	std::size_t GetLastFrameAllocations(MemoryTag tag) const;
+
+	/**
+	 * @brief Gets the display name of a tag.
+	 *
+	 * @param tag The part of the game.
+	 * @return A lowercase name, also used by ParseBudget().
+	 */
+	static const char* GetTagName(MemoryTag tag);
+
+private:
+	/**
+	 * @brief Private constructor to enforce singleton pattern; applies the default budgets.
+	 */
+	MemoryTracker();
+
+	// Deleted copy constructor and assignment operator
+	MemoryTracker(const MemoryTracker&) = delete;
+	MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+private:
+	/**
+	 * @struct TagStats
+	 * @brief The accounting of one tag.
+	 */
+	struct TagStats
+	{
+		std::size_t liveBytes = 0;            ///< Bytes held now
+		std::size_t peakBytes = 0;            ///< Most bytes ever held
+		std::size_t budgetBytes = 0;          ///< Bytes allowed before warning, 0 for no budget
+		std::size_t frameAllocations = 0;     ///< Allocations since the last EndFrame()
+		std::size_t lastFrameAllocations = 0; ///< Allocations of the previous frame
+		std::size_t maxFrameAllocations = 0;  ///< Most allocations a single frame made
+		std::size_t totalAllocations = 0;     ///< Allocations since start-up
+		bool isOverBudget = false;            ///< Whether the warning was printed and live bytes are still over
+	};
+
+	mutable std::mutex m_Mutex;                      ///< Guards everything below, resources are loaded off the main thread
+	std::array<TagStats, MEMORY_TAG_COUNT> m_Stats;  ///< Indexed by MemoryTag
+	std::string m_ReportFile;                        ///< File every report is appended to, empty for none
+};
+
+/**
+ * @class TrackedMemory
+ * @brief Reports the memory of one owner to the MemoryTracker, and gives it back when destroyed.
+ *
+ * Owners keep one as a member and call Resize() whenever the amount they hold changes, typically after a container
+ * grew. Resizing to the current size does nothing, so it is cheap to call after every insertion.
+ */
+class TrackedMemory
+{
+public:
+	/**
+	 * @brief Constructs a handle that holds nothing yet.
+	 *
+	 * @param tag The part of the game the owner belongs to.
+	 */
+	explicit TrackedMemory(MemoryTag tag);
+
+	/**
+	 * @brief Gives the held bytes back to the tracker.
+	 */
+	~TrackedMemory();
+
+	// Deleted copy constructor and assignment operator
+	TrackedMemory(const TrackedMemory&) = delete;
+	TrackedMemory& operator=(const TrackedMemory&) = delete;
+
+	/**
+	 * @brief Reports the amount the owner now holds; growing counts as one allocation.
+	 *
+	 * @param bytes The bytes held.
+	 */
+	void Resize(std::size_t bytes);
+
+	// Getters
+
+	/**
+	 * @brief Gets the bytes reported for the owner.
+	 *
+	 * @return The bytes held.
+	 */
+	inline std::size_t GetBytes() const { return m_Bytes; }
+
+private:
+	MemoryTag m_Tag;     ///< The part of the game the owner belongs to
+	std::size_t m_Bytes; ///< The bytes reported so far
+};
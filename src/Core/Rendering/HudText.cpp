@@ -0,0 +1,87 @@
+#include "stdafx.h"
+#include "HudText.h"
+#include "RenderSnapshot.h"
+#include <charconv>
+
+// ********************* HUD TEXT CONSTANTS ********************
+const sf::Color HUD_FILL_COLOR = sf::Color::White;
+const sf::Color HUD_OUTLINE_COLOR = sf::Color::Blue;
+constexpr float HUD_OUTLINE_THICKNESS = 1.2f;
+// ****************************************************
+
+void HudText::Init(const sf::Font& font, unsigned int characterSize, const sf::Vector2f& position)
+{
+	m_Text.setFont(font);
+	m_Text.setCharacterSize(characterSize);
+	m_Text.setFillColor(HUD_FILL_COLOR);
+	m_Text.setOutlineThickness(HUD_OUTLINE_THICKNESS);
+	m_Text.setOutlineColor(HUD_OUTLINE_COLOR);
+	m_Text.setPosition(position);
+	m_IsDirty = true;
+}
+
+void HudText::SetLabel(std::string_view prefix, std::string_view suffix /*= {}*/)
+{
+	m_Prefix = prefix;
+	m_Suffix = suffix;
+	m_HasValue = false;
+}
+
+void HudText::SetValue(int value)
+{
+	// The common case every tick: nothing changed, nothing to format or rebuild
+	if (m_HasValue && value == m_Value)
+	{
+		return;
+	}
+
+	m_Value = value;
+	m_HasValue = true;
+	Rebuild();
+}
+
+void HudText::SetString(std::string_view text)
+{
+	std::size_t length = 0;
+	Append(text, length);
+	m_Buffer[length] = '\0';
+	m_Text.setString(m_Buffer.data());
+	m_HasValue = false;
+	m_IsDirty = true;
+}
+
+void HudText::Draw(RenderSnapshot& snapshot)
+{
+	// Lays the glyphs out only when the string or the style changed since the last frame
+	if (m_IsDirty)
+	{
+		m_Mesh.Build(m_Text);
+		m_IsDirty = false;
+	}
+	snapshot.Draw(m_Mesh.GetVertices(), m_Mesh.GetTexture());
+}
+
+void HudText::Rebuild()
+{
+	std::size_t length = 0;
+	Append(m_Prefix, length);
+
+	// Formatted in place, no std::to_string
+	const std::to_chars_result result = std::to_chars(m_Buffer.data() + length, m_Buffer.data() + MAX_LENGTH, m_Value);
+	if (result.ec == std::errc())
+	{
+		length = static_cast<std::size_t>(result.ptr - m_Buffer.data());
+	}
+
+	Append(m_Suffix, length);
+	m_Buffer[length] = '\0';
+	m_Text.setString(m_Buffer.data());
+	m_IsDirty = true;
+}
+
+void HudText::Append(std::string_view text, std::size_t& length)
+{
+	const std::size_t count = std::min(text.size(), MAX_LENGTH - length);
+	std::copy_n(text.data(), count, m_Buffer.data() + length);
+	length += count;
+}
@@ -0,0 +1,102 @@
+/*!
+ * \file HudText.h
+ *
+ * \brief Contains the HudText class, a retained HUD label that only rebuilds its text when its value changes.
+ *
+ * The RenderSnapshot lays every text it records out into glyph quads, every frame, and formatting a counter into a
+ * std::string every tick allocated on top of that. A HudText keeps its own TextMesh and records its vertices, laying
+ * the text out again only when it changed, and formats its number into a fixed buffer only when the number changes.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "TextMesh.h"
+class RenderSnapshot;
+
+/**
+ * @class HudText
+ * @brief A HUD label made of a fixed prefix, an optional number and a fixed suffix, e.g. "Lives: 3".
+ *
+ * Typical usage:
+ * - Init() once with the font, then SetLabel() for a counter or SetString() for a fixed text
+ * - SetValue() every tick; it returns at once while the value stays the same
+ * - Draw() every frame
+ */
+class HudText
+{
+public:
+	static constexpr std::size_t MAX_LENGTH = 64; ///< Longest text a HudText shows, longer labels are cut
+
+	/**
+	 * @brief Sets the font and gives the text the look shared by the HUD: white, with a blue outline.
+	 *
+	 * @param font The font; it must outlive the text.
+	 * @param characterSize The character size, in pixels.
+	 * @param position The position of the text.
+	 */
+	void Init(const sf::Font& font, unsigned int characterSize, const sf::Vector2f& position);
+
+	/**
+	 * @brief Sets the text around the value; the value is shown from the next SetValue().
+	 *
+	 * @param prefix The text in front of the value, e.g. "Lives: ".
+	 * @param suffix The text after the value, e.g. "%".
+	 */
+	void SetLabel(std::string_view prefix, std::string_view suffix = {});
+
+	/**
+	 * @brief Shows a value, rebuilding the text only if it differs from the one shown.
+	 *
+	 * @param value The value to show between the prefix and the suffix.
+	 */
+	void SetValue(int value);
+
+	/**
+	 * @brief Shows a fixed text without any value.
+	 *
+	 * @param text The text to show.
+	 */
+	void SetString(std::string_view text);
+
+	/**
+	 * @brief Records the text into the frame's snapshot, building its glyph quads first if it changed.
+	 *
+	 * @param snapshot The frame being recorded.
+	 */
+	void Draw(RenderSnapshot& snapshot);
+
+	// Getters
+
+	/**
+	 * @brief Gets the underlying text, to set its origin, position or colors; the text is laid out again next Draw().
+	 *
+	 * @return The text.
+	 */
+	inline sf::Text& GetText() { m_IsDirty = true; return m_Text; }
+
+private:
+	/**
+	 * @brief Formats the prefix, the value and the suffix into the buffer and hands it to the text.
+	 */
+	void Rebuild();
+
+	/**
+	 * @brief Appends characters to the buffer, cutting them at MAX_LENGTH.
+	 *
+	 * @param text The characters to append.
+	 * @param length The length of the buffer so far, updated.
+	 */
+	void Append(std::string_view text, std::size_t& length);
+
+private:
+	sf::Text m_Text;                                ///< The text shown, never drawn itself
+	TextMesh m_Mesh;                                ///< The glyph quads of m_Text, recorded every frame
+	std::array<char, MAX_LENGTH + 1> m_Buffer = {}; ///< The formatted text, null-terminated
+	std::string m_Prefix;                           ///< Text in front of the value, set once
+	std::string m_Suffix;                           ///< Text after the value, set once
+	int m_Value = 0;                                ///< The value shown
+	bool m_HasValue = false;                        ///< False until the first SetValue() after SetLabel()
+	bool m_IsDirty = true;                          ///< True when m_Mesh no longer matches m_Text
+};
@@ -0,0 +1,72 @@
+#include "stdafx.h"
+#include "ParallaxBackground.h"
+#include "RenderSnapshot.h"
+#include "Core/Managers/ResourceCache.h"
+
+void ParallaxBackground::SetViewSize(const sf::Vector2f& viewSize)
+{
+	m_ViewSize = viewSize;
+}
+
+bool ParallaxBackground::AddLayer(const std::string& fileName, float scrollSpeed)
+{
+	// A standalone texture, wrapping the coordinates of an atlas page would show its neighbours
+	std::shared_ptr<sf::Texture> texture = ResourceCache::Get().GetTexture(fileName);
+	if (texture == nullptr)
+	{
+		Log::Print("Failed to load background layer", fileName, LogLevel::ERROR_);
+		return false;
+	}
+	// Changes the texture's GL state through the main thread's shared context; no frame drew it yet
+	texture->setRepeated(true);
+
+	Layer layer;
+	layer.texture = std::move(texture);
+	layer.scrollSpeed = scrollSpeed;
+	layer.quad = sf::VertexArray(sf::PrimitiveType::TriangleStrip, 4);
+	m_Layers.push_back(std::move(layer));
+	return true;
+}
+
+void ParallaxBackground::Reset()
+{
+	for (Layer& layer : m_Layers)
+	{
+		layer.offset = 0.0f;
+		layer.previousOffset = 0.0f;
+	}
+}
+
+void ParallaxBackground::Update(float deltaTime)
+{
+	for (Layer& layer : m_Layers)
+	{
+		layer.previousOffset = layer.offset;
+		layer.offset += layer.scrollSpeed * deltaTime;
+
+		// The texture repeats, so whole turns change nothing; dropping them keeps the offsets small and precise
+		const float height = static_cast<float>(layer.texture->getSize().y);
+		if (height > 0.0f && layer.offset >= height)
+		{
+			layer.offset -= height;
+			layer.previousOffset -= height;
+		}
+	}
+}
+
+void ParallaxBackground::Draw(RenderSnapshot& snapshot, float alpha)
+{
+	for (Layer& layer : m_Layers)
+	{
+		// The image moves down the screen, so the texture coordinates at the top of the screen move up
+		const float offset = layer.previousOffset + (layer.offset - layer.previousOffset) * alpha;
+		const float top = -offset;
+		const float bottom = top + m_ViewSize.y;
+
+		layer.quad[0] = sf::Vertex(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(0.0f, top));
+		layer.quad[1] = sf::Vertex(sf::Vector2f(m_ViewSize.x, 0.0f), sf::Vector2f(m_ViewSize.x, top));
+		layer.quad[2] = sf::Vertex(sf::Vector2f(0.0f, m_ViewSize.y), sf::Vector2f(0.0f, bottom));
+		layer.quad[3] = sf::Vertex(sf::Vector2f(m_ViewSize.x, m_ViewSize.y), sf::Vector2f(m_ViewSize.x, bottom));
+		snapshot.Draw(layer.quad, layer.texture.get());
+	}
+}
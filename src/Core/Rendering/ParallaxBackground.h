@@ -0,0 +1,90 @@
+/*!
+ * \file ParallaxBackground.h
+ *
+ * \brief Contains the ParallaxBackground class, which scrolls layers of repeated textures behind a scene.
+ *
+ * A scrolling background used to be two full-screen sprites leapfrogging each other, both drawn every frame. Each layer
+ * here is a single screen-sized quad instead: its texture is set to repeat and the quad's texture coordinates scroll,
+ * so the GPU wraps the image around and every layer costs one full-screen fill. Layers are drawn in the order they were
+ * added and scroll at their own speed, the slower ones looking further away.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+class RenderSnapshot;
+
+/**
+ * @class ParallaxBackground
+ * @brief Vertically scrolling background made of repeated-texture layers.
+ *
+ * Typical usage:
+ * - SetViewSize() and AddLayer() once, when the scene acquires its assets
+ * - Reset() when a run starts
+ * - Update() every tick and Draw() every frame
+ *
+ * Draw() places the layers between their last two simulated offsets, like the entities, so the background scrolls
+ * smoothly at any display rate.
+ */
+class ParallaxBackground
+{
+public:
+	/**
+	 * @brief Sets the size of the area the layers cover.
+	 *
+	 * @param viewSize The size of the view, in pixels; usually the window's.
+	 */
+	void SetViewSize(const sf::Vector2f& viewSize);
+
+	/**
+	 * @brief Adds a layer in front of the existing ones.
+	 *
+	 * Sets the texture to repeat. The texture must be a standalone one, not an atlas page. Called on the main thread,
+	 * possibly while the render thread draws a frame: the change goes through SFML's hidden context, shared with the
+	 * window's, and the texture is not drawn by any frame before this scene records one.
+	 *
+	 * @param fileName The path of the layer's image.
+	 * @param scrollSpeed How fast the image moves down the screen, in pixels per second.
+	 * @return False if the texture could not be loaded.
+	 */
+	bool AddLayer(const std::string& fileName, float scrollSpeed);
+
+	/**
+	 * @brief Scrolls every layer back to its start.
+	 */
+	void Reset();
+
+	/**
+	 * @brief Scrolls every layer by one tick.
+	 *
+	 * @param deltaTime The time step of the tick, in seconds.
+	 */
+	void Update(float deltaTime);
+
+	/**
+	 * @brief Records every layer into the frame's snapshot, back to front.
+	 *
+	 * @param snapshot The frame being recorded.
+	 * @param alpha How far the frame is between the previous tick (0) and the current tick (1).
+	 */
+	void Draw(RenderSnapshot& snapshot, float alpha);
+
+private:
+	/**
+	 * @struct Layer
+	 * @brief One repeated texture and its scroll state.
+	 */
+	struct Layer
+	{
+		std::shared_ptr<sf::Texture> texture; ///< The repeated texture
+		float scrollSpeed = 0.0f;             ///< Pixels per second the image moves down
+		float offset = 0.0f;                  ///< Distance scrolled at the current tick, wrapped to the texture height
+		float previousOffset = 0.0f;          ///< Distance scrolled at the previous tick
+		sf::VertexArray quad;                 ///< The screen-sized quad, kept to record it without allocating
+	};
+
+private:
+	std::vector<Layer> m_Layers; ///< Back to front
+	sf::Vector2f m_ViewSize;     ///< Size of the quads, in pixels
+};
@@ -0,0 +1,236 @@
+#include "stdafx.h"
+#include "PerfOverlay.h"
+#include "RenderStats.h"
+#include "RenderSnapshot.h"
+#include "Core/Utility/Strings.h"
+#include "Core/Managers/ResourceCache.h"
+#include "Core/Memory/FrameArena.h"
+#include "Core/Memory/AllocationCounter.h"
+
+// ********************* PERF OVERLAY CONSTANTS ********************
+constexpr float GRAPH_WIDTH = 480.0f;
+constexpr float GRAPH_HEIGHT = 120.0f;
+constexpr float GRAPH_MARGIN = 10.0f;
+constexpr float GRAPH_MAX_FRAME_TIME = 0.05f;         // Frame time at the top of the graph, in seconds
+constexpr float BUDGET_60_HZ = 1.0f / 60.0f;
+constexpr float BUDGET_30_HZ = 1.0f / 30.0f;
+constexpr float REFRESH_INTERVAL = 0.25f;             // Seconds between two recomputations of the text values
+constexpr unsigned int TEXT_SIZE = 16;
+constexpr std::size_t VERTICES_PER_RECT = 6;
+constexpr std::size_t PANEL_RECT = 0;                 // Rect index of the background panel
+constexpr std::size_t BUDGET_60_RECT = 1;             // Rect index of the 60 Hz budget line
+constexpr std::size_t BUDGET_30_RECT = 2;             // Rect index of the 30 Hz budget line
+constexpr std::size_t FIRST_BAR_RECT = 3;             // Rect index of the oldest frame's bar
+const sf::Color PANEL_COLOR(0, 0, 0, 160);
+const sf::Color BUDGET_LINE_COLOR(255, 255, 255, 90);
+const sf::Color FAST_FRAME_COLOR(60, 200, 80);
+const sf::Color SLOW_FRAME_COLOR(230, 200, 40);
+const sf::Color DROPPED_FRAME_COLOR(220, 50, 50);
+// ****************************************************
+
+PerfOverlay::PerfOverlay()
+	: m_IsVisible(false)
+	, m_FrameTimes{}
+	, m_SortedFrameTimes{}
+	, m_NextFrame(0)
+	, m_FrameCount(0)
+	, m_Graph(sf::Triangles, (FIRST_BAR_RECT + FRAME_HISTORY) * VERTICES_PER_RECT)
+	, m_TimeSinceRefresh(REFRESH_INTERVAL)
+	, m_CostAccumulator(0.0f)
+	, m_CostSamples(0)
+	, m_Memory(MemoryTag::UI)
+{
+	m_Memory.Resize(m_Graph.getVertexCount() * sizeof(sf::Vertex));
+}
+
+void PerfOverlay::Init(const sf::Vector2u& windowSize)
+{
+	m_Origin = sf::Vector2f(windowSize.x - GRAPH_WIDTH - GRAPH_MARGIN, GRAPH_MARGIN);
+
+	// The panel and the budget lines never move, only the bars are rewritten every frame
+	SetRect(PANEL_RECT, sf::FloatRect(m_Origin.x, m_Origin.y, GRAPH_WIDTH, GRAPH_HEIGHT), PANEL_COLOR);
+	const float scale = GRAPH_HEIGHT / GRAPH_MAX_FRAME_TIME;
+	SetRect(BUDGET_60_RECT, sf::FloatRect(m_Origin.x, m_Origin.y + GRAPH_HEIGHT - BUDGET_60_HZ * scale, GRAPH_WIDTH, 1.0f), BUDGET_LINE_COLOR);
+	SetRect(BUDGET_30_RECT, sf::FloatRect(m_Origin.x, m_Origin.y + GRAPH_HEIGHT - BUDGET_30_HZ * scale, GRAPH_WIDTH, 1.0f), BUDGET_LINE_COLOR);
+
+	m_Font = ResourceCache::Get().GetFont(FONT_A);
+	if (m_Font == nullptr)
+	{
+		Log::Print("Error loading font!", LogLevel::ERROR_);
+		return;
+	}
+
+	m_Text.setFont(*m_Font);
+	m_Text.setCharacterSize(TEXT_SIZE);
+	m_Text.setFillColor(sf::Color::White);
+	m_Text.setPosition(m_Origin.x, m_Origin.y + GRAPH_HEIGHT + GRAPH_MARGIN);
+}
+
+void PerfOverlay::Toggle()
+{
+	m_IsVisible = !m_IsVisible;
+
+	// Show fresh numbers straight away
+	m_TimeSinceRefresh = REFRESH_INTERVAL;
+}
+
+void PerfOverlay::AddFrameTime(float frameTime)
+{
+	m_FrameTimes[m_NextFrame] = frameTime;
+	m_NextFrame = (m_NextFrame + 1) % FRAME_HISTORY;
+	m_FrameCount = std::min(m_FrameCount + 1, FRAME_HISTORY);
+	m_TimeSinceRefresh += frameTime;
+}
+
+void PerfOverlay::Update(const SceneStats& stats)
+{
+	m_CostClock.restart();
+
+	UpdateGraph();
+
+	// Recompute the numbers a few times per second; the text is only rebuilt when one of them changed
+	if (m_TimeSinceRefresh >= REFRESH_INTERVAL)
+	{
+		m_TimeSinceRefresh = 0.0f;
+
+		const DisplayedValues values = ComputeValues(stats);
+		if (!(values == m_Displayed))
+		{
+			RebuildText(values);
+			m_Displayed = values;
+		}
+	}
+
+	m_CostAccumulator += m_CostClock.getElapsedTime().asSeconds();
+}
+
+void PerfOverlay::Draw(RenderSnapshot& snapshot)
+{
+	m_CostClock.restart();
+
+	snapshot.Draw(m_Graph);
+
+	if (m_Font != nullptr)
+	{
+		snapshot.Draw(m_Text);
+	}
+
+	m_CostAccumulator += m_CostClock.getElapsedTime().asSeconds();
+	++m_CostSamples;
+}
+
+void PerfOverlay::UpdateGraph()
+{
+	const float barWidth = GRAPH_WIDTH / FRAME_HISTORY;
+	const float scale = GRAPH_HEIGHT / GRAPH_MAX_FRAME_TIME;
+
+	// Oldest frame on the left, newest on the right; empty slots get zero-height bars
+	const std::size_t oldest = (m_NextFrame + FRAME_HISTORY - m_FrameCount) % FRAME_HISTORY;
+	const std::size_t emptySlots = FRAME_HISTORY - m_FrameCount;
+	for (std::size_t i = 0; i < FRAME_HISTORY; ++i)
+	{
+		const float frameTime = (i >= emptySlots) ? m_FrameTimes[(oldest + i - emptySlots) % FRAME_HISTORY] : 0.0f;
+		const float height = std::min(frameTime, GRAPH_MAX_FRAME_TIME) * scale;
+
+		const sf::Color& color = (frameTime <= BUDGET_60_HZ) ? FAST_FRAME_COLOR
+			: (frameTime <= BUDGET_30_HZ) ? SLOW_FRAME_COLOR : DROPPED_FRAME_COLOR;
+
+		SetRect(FIRST_BAR_RECT + i, sf::FloatRect(m_Origin.x + i * barWidth, m_Origin.y + GRAPH_HEIGHT - height, barWidth, height), color);
+	}
+}
+
+PerfOverlay::DisplayedValues PerfOverlay::ComputeValues(const SceneStats& stats)
+{
+	DisplayedValues values;
+	values.enemies = stats.enemies;
+	values.enemyProjectiles = stats.enemyProjectiles;
+	values.playerProjectiles = stats.playerProjectiles;
+	values.drawCalls = RenderStats::Get().GetDrawCalls();
+	values.textureBinds = RenderStats::Get().GetTextureBinds();
+	values.batchedSprites = stats.batchedSprites;
+	values.drawCallsSaved = stats.drawCallsSaved;
+	values.heapAllocations = AllocationCounter::GetLastFrameAllocations();
+	values.frameArenaPeak = FrameArena::Get().GetPeak() / 1024;
+
+	// Keep the last measurement until the overlay has been drawn again
+	values.overlayCost = std::max(0, m_Displayed.overlayCost);
+	if (m_CostSamples > 0)
+	{
+		values.overlayCost = static_cast<int>(m_CostAccumulator / m_CostSamples * 1000000.0f);
+		m_CostAccumulator = 0.0f;
+		m_CostSamples = 0;
+	}
+
+	if (m_FrameCount == 0)
+	{
+		return values;
+	}
+
+	// Min and average over the history, the order does not matter here
+	float minFrameTime = m_FrameTimes[0];
+	float totalFrameTime = 0.0f;
+	for (std::size_t i = 0; i < m_FrameCount; ++i)
+	{
+		minFrameTime = std::min(minFrameTime, m_FrameTimes[i]);
+		totalFrameTime += m_FrameTimes[i];
+	}
+	const float averageFrameTime = totalFrameTime / m_FrameCount;
+
+	// The 99th percentile only needs a partial sort of a scratch copy
+	std::copy(m_FrameTimes.begin(), m_FrameTimes.begin() + m_FrameCount, m_SortedFrameTimes.begin());
+	const std::size_t p99Index = (m_FrameCount * 99 + 99) / 100 - 1;
+	std::nth_element(m_SortedFrameTimes.begin(), m_SortedFrameTimes.begin() + p99Index, m_SortedFrameTimes.begin() + m_FrameCount);
+
+	values.fps = static_cast<int>(std::lround(1.0f / averageFrameTime));
+	values.minFrameTime = static_cast<int>(std::lround(minFrameTime * 100000.0f));
+	values.averageFrameTime = static_cast<int>(std::lround(averageFrameTime * 100000.0f));
+	values.p99FrameTime = static_cast<int>(std::lround(m_SortedFrameTimes[p99Index] * 100000.0f));
+	return values;
+}
+
+void PerfOverlay::RebuildText(const DisplayedValues& values)
+{
+	// Formatted on the stack, only setString() touches the heap
+	char heapAllocations[24] = "off";
+	if (AllocationCounter::IS_ENABLED)
+	{
+		std::snprintf(heapAllocations, sizeof(heapAllocations), "%zu", values.heapAllocations);
+	}
+
+	char buffer[384];
+	std::snprintf(buffer, sizeof(buffer),
+		"FPS %d\n"
+		"Frame ms  min %d.%02d  avg %d.%02d  p99 %d.%02d\n"
+		"Enemies %zu  Enemy shots %zu  Player shots %zu\n"
+		"Draw calls %zu  Texture binds %zu\n"
+		"Batched sprites %zu  Draw calls saved %zu\n"
+		"Heap allocs/frame %s  Frame arena peak %zu KB\n"
+		"Overlay %d us",
+		values.fps,
+		values.minFrameTime / 100, values.minFrameTime % 100,
+		values.averageFrameTime / 100, values.averageFrameTime % 100,
+		values.p99FrameTime / 100, values.p99FrameTime % 100,
+		values.enemies, values.enemyProjectiles, values.playerProjectiles,
+		values.drawCalls, values.textureBinds,
+		values.batchedSprites, values.drawCallsSaved,
+		heapAllocations, values.frameArenaPeak,
+		values.overlayCost);
+
+	m_Text.setString(buffer);
+}
+
+void PerfOverlay::SetRect(std::size_t rectIndex, const sf::FloatRect& rect, const sf::Color& color)
+{
+	const std::size_t first = rectIndex * VERTICES_PER_RECT;
+	const sf::Vector2f topLeft(rect.left, rect.top);
+	const sf::Vector2f topRight(rect.left + rect.width, rect.top);
+	const sf::Vector2f bottomRight(rect.left + rect.width, rect.top + rect.height);
+	const sf::Vector2f bottomLeft(rect.left, rect.top + rect.height);
+
+	m_Graph[first + 0] = sf::Vertex(topLeft, color);
+	m_Graph[first + 1] = sf::Vertex(topRight, color);
+	m_Graph[first + 2] = sf::Vertex(bottomRight, color);
+	m_Graph[first + 3] = sf::Vertex(topLeft, color);
+	m_Graph[first + 4] = sf::Vertex(bottomRight, color);
+	m_Graph[first + 5] = sf::Vertex(bottomLeft, color);
+}
@@ -0,0 +1,160 @@
+/*!
+ * \file PerfOverlay.h
+ *
+ * \brief Contains the PerfOverlay class, a toggleable layer drawn over every scene showing frame time, entity counts
+ * and draw calls.
+ *
+ * The overlay is meant to stay on while profiling, so it is built to cost almost nothing: the frame-time graph is one
+ * vertex array of fixed size drawn in a single call, and the statistics text is rebuilt only when one of its values
+ * changes, at most a few times per second.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "Core/Memory/MemoryTracker.h"
+class RenderSnapshot;
+
+/**
+ * @class PerfOverlay
+ * @brief Draws an FPS counter, a rolling frame-time graph and live counts in the top-right corner of the window.
+ *
+ * Every frame:
+ * - AddFrameTime() with the real duration of the frame, even while hidden, so the graph is full when shown
+ * - Update() and Draw() after the scene, only while visible
+ *
+ * The text shows the minimum, average and 99th percentile frame time of the graph's history, the entity counts of the
+ * active scene, the draw calls and texture binds of the previous frame, as recorded in RenderStats, the sprites the
+ * scene batched and the draw calls that saved, and the heap allocations and frame arena use of the frame loop.
+ */
+class PerfOverlay
+{
+public:
+	static constexpr std::size_t FRAME_HISTORY = 240; ///< Frames shown in the graph, 4 seconds at 60 Hz
+
+	/**
+	 * @brief Constructs a hidden overlay.
+	 */
+	PerfOverlay();
+
+	/**
+	 * @brief Loads the font and lays out the graph in the top-right corner.
+	 *
+	 * @param windowSize The size of the window the overlay is drawn on.
+	 */
+	void Init(const sf::Vector2u& windowSize);
+
+	/**
+	 * @brief Shows the overlay if hidden, hides it if shown.
+	 */
+	void Toggle();
+
+	/**
+	 * @brief Adds the duration of a frame to the history.
+	 *
+	 * @param frameTime The real duration of the frame, in seconds.
+	 */
+	void AddFrameTime(float frameTime);
+
+	/**
+	 * @brief Refreshes the graph and, when its values changed, the text.
+	 *
+	 * @param stats The live entity counts of the active scene.
+	 */
+	void Update(const SceneStats& stats);
+
+	/**
+	 * @brief Records the graph and the text, in two draw calls.
+	 *
+	 * @param snapshot The frame being recorded.
+	 */
+	void Draw(RenderSnapshot& snapshot);
+
+	// Getters
+
+	/**
+	 * @brief Checks whether the overlay is shown.
+	 *
+	 * @return True if shown.
+	 */
+	inline bool IsVisible() const { return m_IsVisible; }
+
+private:
+	/**
+	 * @struct DisplayedValues
+	 * @brief The numbers currently shown by the text, compared to decide whether it needs rebuilding.
+	 */
+	struct DisplayedValues
+	{
+		int fps = -1;                     ///< Frames per second
+		int minFrameTime = -1;            ///< Shortest frame, in hundredths of a millisecond
+		int averageFrameTime = -1;        ///< Average frame, in hundredths of a millisecond
+		int p99FrameTime = -1;            ///< 99th percentile frame, in hundredths of a millisecond
+		std::size_t enemies = 0;          ///< Enemies alive
+		std::size_t enemyProjectiles = 0; ///< Enemy projectiles in flight
+		std::size_t playerProjectiles = 0;///< Player projectiles in flight
+		std::size_t drawCalls = 0;        ///< Draw calls of the previous frame
+		std::size_t textureBinds = 0;     ///< Texture binds of the previous frame
+		std::size_t batchedSprites = 0;   ///< Sprites the scene drew through its SpriteBatch
+		std::size_t drawCallsSaved = 0;   ///< Draw calls the SpriteBatch saved
+		std::size_t heapAllocations = 0;  ///< Heap allocations of the previous frame's loop (MOO_COUNT_ALLOCATIONS)
+		std::size_t frameArenaPeak = 0;   ///< Most FrameArena memory a frame used, in KiB
+		int overlayCost = -1;             ///< Average cost of the overlay itself, in microseconds
+
+		bool operator==(const DisplayedValues& other) const = default;
+	};
+
+	/**
+	 * @brief Moves the graph's bars to the current frame history.
+	 */
+	void UpdateGraph();
+
+	/**
+	 * @brief Computes the values to display from the frame history and the given counts.
+	 *
+	 * @param stats The live entity counts of the active scene.
+	 * @return The values to display.
+	 */
+	DisplayedValues ComputeValues(const SceneStats& stats);
+
+	/**
+	 * @brief Rebuilds the text from the given values.
+	 *
+	 * @param values The values to display.
+	 */
+	void RebuildText(const DisplayedValues& values);
+
+	/**
+	 * @brief Writes the two triangles of an axis-aligned rectangle into the graph.
+	 *
+	 * @param rectIndex Index of the rectangle in the graph, six vertices each.
+	 * @param rect The rectangle, in window coordinates.
+	 * @param color The fill color.
+	 */
+	void SetRect(std::size_t rectIndex, const sf::FloatRect& rect, const sf::Color& color);
+
+private:
+	bool m_IsVisible;                                   ///< Whether the overlay is drawn
+
+	// Frame history
+	std::array<float, FRAME_HISTORY> m_FrameTimes;      ///< Ring of the latest frame times, in seconds
+	std::array<float, FRAME_HISTORY> m_SortedFrameTimes;///< Scratch copy used to find the 99th percentile
+	std::size_t m_NextFrame;                            ///< Slot the next frame time is written to
+	std::size_t m_FrameCount;                           ///< Number of valid slots, up to FRAME_HISTORY
+
+	// Drawing
+	sf::Vector2f m_Origin;                              ///< Top-left corner of the graph panel
+	sf::VertexArray m_Graph;                            ///< Panel, budget lines and one bar per frame, as triangles
+	std::shared_ptr<sf::Font> m_Font;                   ///< Font of the statistics text
+	sf::Text m_Text;                                    ///< The statistics text
+
+	// Text refresh
+	DisplayedValues m_Displayed;                        ///< Values the text currently shows
+	float m_TimeSinceRefresh;                           ///< Real time since the values were last recomputed
+	float m_CostAccumulator;                            ///< Time spent in Update() and Draw() since the last refresh
+	int m_CostSamples;                                  ///< Frames accumulated in m_CostAccumulator
+	sf::Clock m_CostClock;                              ///< Measures the overlay's own cost
+
+	TrackedMemory m_Memory;                             ///< The graph's vertices, reported as UI
+};
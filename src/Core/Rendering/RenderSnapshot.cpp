@@ -0,0 +1,84 @@
+#include "stdafx.h"
+#include "RenderSnapshot.h"
+#include "RenderStats.h"
+
+void RenderSnapshot::Clear()
+{
+	// The arrays only grow while recording, so the previous frame's capacity is what they hold now
+	m_Memory.Resize(m_Commands.capacity() * sizeof(Command) + m_Sprites.capacity() * sizeof(sf::Sprite)
+		+ m_Shapes.capacity() * sizeof(sf::RectangleShape)
+		+ m_Vertices.capacity() * sizeof(sf::Vertex));
+
+	m_Commands.clear();
+	m_Vertices.clear();
+	m_UsedSprites = 0;
+	m_UsedShapes = 0;
+}
+
+void RenderSnapshot::Draw(const sf::Sprite& sprite)
+{
+	Command command;
+	command.type = CommandType::SPRITE;
+	command.index = Store(m_Sprites, m_UsedSprites, sprite);
+	m_Commands.push_back(command);
+
+	RenderStats::Get().RecordDraw(sprite.getTexture());
+}
+
+void RenderSnapshot::Draw(const sf::Text& text)
+{
+	m_TextMesh.Build(text);
+	Draw(m_TextMesh.GetVertices(), m_TextMesh.GetTexture());
+}
+
+void RenderSnapshot::Draw(const sf::RectangleShape& shape)
+{
+	Command command;
+	command.type = CommandType::SHAPE;
+	command.index = Store(m_Shapes, m_UsedShapes, shape);
+	m_Commands.push_back(command);
+
+	RenderStats::Get().RecordDraw(shape.getTexture());
+}
+
+void RenderSnapshot::Draw(const sf::VertexArray& vertices, const sf::Texture* texture /*= nullptr*/)
+{
+	const std::size_t vertexCount = vertices.getVertexCount();
+	if (vertexCount == 0)
+	{
+		return;
+	}
+
+	Command command;
+	command.type = CommandType::VERTICES;
+	command.index = m_Vertices.size();
+	command.vertexCount = vertexCount;
+	command.primitive = vertices.getPrimitiveType();
+	command.texture = texture;
+	m_Commands.push_back(command);
+
+	m_Vertices.insert(m_Vertices.end(), &vertices[0], &vertices[0] + vertexCount);
+
+	RenderStats::Get().RecordDraw(texture);
+}
+
+void RenderSnapshot::Submit(sf::RenderTarget& target) const
+{
+	for (const Command& command : m_Commands)
+	{
+		switch (command.type)
+		{
+		case CommandType::SPRITE:
+			target.draw(m_Sprites[command.index]);
+			break;
+
+		case CommandType::SHAPE:
+			target.draw(m_Shapes[command.index]);
+			break;
+
+		case CommandType::VERTICES:
+			target.draw(&m_Vertices[command.index], command.vertexCount, command.primitive, sf::RenderStates(command.texture));
+			break;
+		}
+	}
+}
@@ -0,0 +1,149 @@
+/*!
+ * \file RenderSnapshot.h
+ *
+ * \brief Contains the RenderSnapshot class, the frozen list of everything one frame draws, recorded by the main thread
+ * and replayed by the render thread.
+ *
+ * Scenes do not draw to the window anymore: they record their sprites (transform, texture region, color), texts and
+ * vertex arrays into a snapshot, by value. Once recorded the snapshot does not reference any scene object, so the
+ * simulation can keep changing its state while the RenderThread draws the previous frame from its own copy. Texts are
+ * recorded as the vertices of their glyphs, laid out by a TextMesh: replaying an sf::Text reads its font, which the main
+ * thread is using at the same time.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "Core/Memory/MemoryTracker.h"
+#include "TextMesh.h"
+
+/**
+ * @class RenderSnapshot
+ * @brief Records draw commands by value and replays them in order on a render target.
+ *
+ * Typical usage per frame:
+ * - Clear() on the main thread
+ * - Draw() every sprite, text, shape and vertex array, in painter's order
+ * - Submit() on the render thread, which must own the target's GL context
+ *
+ * Every stored object keeps its slot between frames and is copied over in place, so once the slots have grown to the
+ * working set recording a frame does not allocate. Textures and fonts are referenced, not copied: they must outlive
+ * the snapshot, which the ResourceCache guarantees for every asset the game draws.
+ */
+class RenderSnapshot
+{
+public:
+	/**
+	 * @brief Forgets the commands of the previous frame, keeping every slot and buffer.
+	 */
+	void Clear();
+
+	/**
+	 * @brief Records a sprite, with its current transform, texture region and color.
+	 *
+	 * @param sprite The sprite to draw.
+	 */
+	void Draw(const sf::Sprite& sprite);
+
+	/**
+	 * @brief Records a text, with its current string, font, size, transform and colors.
+	 *
+	 * The glyphs are laid out here, on the main thread, and recorded as vertices sampling the font's page texture, so
+	 * replaying the frame never reads the font. Texts drawn every frame unchanged should keep their own TextMesh and
+	 * record its vertices instead, like HudText.
+	 *
+	 * @param text The text to draw.
+	 */
+	void Draw(const sf::Text& text);
+
+	/**
+	 * @brief Records a rectangle shape.
+	 *
+	 * @param shape The shape to draw.
+	 */
+	void Draw(const sf::RectangleShape& shape);
+
+	/**
+	 * @brief Records a vertex array, drawn with an optional texture.
+	 *
+	 * @param vertices The vertices to draw; copied.
+	 * @param texture The texture the vertices sample, nullptr for untextured geometry.
+	 */
+	void Draw(const sf::VertexArray& vertices, const sf::Texture* texture = nullptr);
+
+	/**
+	 * @brief Replays every recorded command on a render target, in recording order.
+	 *
+	 * @param target The render target to draw on.
+	 */
+	void Submit(sf::RenderTarget& target) const;
+
+	// Getters
+
+	/**
+	 * @brief Gets the number of draw calls Submit() will issue.
+	 *
+	 * @return The recorded command count.
+	 */
+	inline std::size_t GetCommandCount() const { return m_Commands.size(); }
+
+private:
+	/**
+	 * @enum CommandType
+	 * @brief Which slot array a command reads from.
+	 */
+	enum class CommandType
+	{
+		SPRITE,   ///< One of m_Sprites
+		SHAPE,    ///< One of m_Shapes
+		VERTICES  ///< A range of m_Vertices
+	};
+
+	/**
+	 * @struct Command
+	 * @brief One recorded draw call.
+	 */
+	struct Command
+	{
+		CommandType type = CommandType::SPRITE;                 ///< What to draw
+		std::size_t index = 0;                                  ///< Slot index, or first vertex for VERTICES
+		std::size_t vertexCount = 0;                            ///< Number of vertices (VERTICES)
+		sf::PrimitiveType primitive = sf::PrimitiveType::Points; ///< How the vertices are assembled (VERTICES)
+		const sf::Texture* texture = nullptr;                   ///< Texture of the vertices (VERTICES)
+	};
+
+	/**
+	 * @brief Copies an object into the next free slot of its array, reusing the slot's memory when it exists.
+	 *
+	 * @tparam T The stored type.
+	 * @param slots The slot array.
+	 * @param usedSlots Number of slots used this frame; incremented.
+	 * @param object The object to copy.
+	 * @return The index of the slot written.
+	 */
+	template <typename T>
+	static std::size_t Store(std::vector<T>& slots, std::size_t& usedSlots, const T& object)
+	{
+		if (usedSlots < slots.size())
+		{
+			slots[usedSlots] = object;
+		}
+		else
+		{
+			slots.push_back(object);
+		}
+		return usedSlots++;
+	}
+
+private:
+	std::vector<Command> m_Commands;         ///< Draw calls of the frame, in order
+
+	std::vector<sf::Sprite> m_Sprites;       ///< Sprite slots; only the first m_UsedSprites are live this frame
+	std::vector<sf::RectangleShape> m_Shapes;///< Shape slots; only the first m_UsedShapes are live this frame
+	std::vector<sf::Vertex> m_Vertices;      ///< Vertices of every VERTICES command, back to back
+	std::size_t m_UsedSprites = 0;           ///< Sprite slots used since Clear()
+	std::size_t m_UsedShapes = 0;            ///< Shape slots used since Clear()
+	TextMesh m_TextMesh;                     ///< Scratch layout of the text being recorded
+	TrackedMemory m_Memory{ MemoryTag::SCENE }; ///< Capacity of the arrays above, reported as scene
+};
@@ -0,0 +1,98 @@
+/*!
+ * \file RenderStats.h
+ *
+ * \brief Contains the RenderStats singleton, which counts the draw calls and texture binds of every frame.
+ *
+ * SFML does not report what it sends to the GPU, so every command recorded into a RenderSnapshot is counted here, on
+ * the main thread, when it is recorded; the render thread replays exactly those commands.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @class RenderStats
+ * @brief Counts draw calls and texture changes between two BeginFrame() calls.
+ *
+ * A texture bind is counted whenever a draw uses a different texture than the draw before it, which is when SFML
+ * has to rebind. Drawing with no texture (shapes) counts as a change too.
+ */
+class RenderStats
+{
+public:
+	/**
+	 * @brief Retrieves the singleton instance of the RenderStats.
+	 *
+	 * @return Reference to the global RenderStats instance.
+	 */
+	static RenderStats& Get()
+	{
+		static RenderStats instance;
+		return instance;
+	}
+
+	/**
+	 * @brief Publishes the counts of the frame that just ended and starts counting a new one.
+	 */
+	inline void BeginFrame()
+	{
+		m_LastDrawCalls = m_DrawCalls;
+		m_LastTextureBinds = m_TextureBinds;
+		m_DrawCalls = 0;
+		m_TextureBinds = 0;
+		m_BoundTexture = nullptr;
+		m_HasBoundTexture = false;
+	}
+
+	/**
+	 * @brief Records one draw call.
+	 *
+	 * @param texture The texture the draw samples, nullptr for untextured geometry.
+	 */
+	inline void RecordDraw(const sf::Texture* texture)
+	{
+		++m_DrawCalls;
+		if (!m_HasBoundTexture || texture != m_BoundTexture)
+		{
+			++m_TextureBinds;
+			m_BoundTexture = texture;
+			m_HasBoundTexture = true;
+		}
+	}
+
+	// Getters
+
+	/**
+	 * @brief Gets the number of draw calls of the last complete frame.
+	 *
+	 * @return The draw call count.
+	 */
+	inline std::size_t GetDrawCalls() const { return m_LastDrawCalls; }
+
+	/**
+	 * @brief Gets the number of texture binds of the last complete frame.
+	 *
+	 * @return The texture bind count.
+	 */
+	inline std::size_t GetTextureBinds() const { return m_LastTextureBinds; }
+
+private:
+	/**
+	 * @brief Private constructor to enforce singleton pattern.
+	 */
+	RenderStats() = default;
+
+	// Deleted copy constructor and assignment operator
+	RenderStats(const RenderStats&) = delete;
+	RenderStats& operator=(const RenderStats&) = delete;
+
+private:
+	std::size_t m_DrawCalls = 0;              ///< Draw calls recorded since BeginFrame()
+	std::size_t m_TextureBinds = 0;           ///< Texture changes recorded since BeginFrame()
+	std::size_t m_LastDrawCalls = 0;          ///< Draw calls of the last complete frame
+	std::size_t m_LastTextureBinds = 0;       ///< Texture changes of the last complete frame
+	const sf::Texture* m_BoundTexture = nullptr; ///< Texture of the previous draw
+	bool m_HasBoundTexture = false;           ///< False until the first draw of the frame
+};
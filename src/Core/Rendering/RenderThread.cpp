@@ -0,0 +1,134 @@
+#include "stdafx.h"
+#include "RenderThread.h"
+
+RenderThread::RenderThread()
+	: m_Window(nullptr)
+	, m_BackIndex(0)
+	, m_FrontIndex(1)
+	, m_HasPendingFrame(false)
+	, m_IsDrawing(false)
+	, m_IsStopping(false)
+{
+}
+
+RenderThread::~RenderThread()
+{
+	Stop();
+}
+
+void RenderThread::Start(sf::RenderWindow& window)
+{
+	if (IsRunning())
+	{
+		return;
+	}
+
+	m_Window = &window;
+	m_IsStopping = false;
+
+	// A GL context can only be active on one thread at a time
+	m_Window->setActive(false);
+	m_Thread = std::thread(&RenderThread::ThreadLoop, this);
+
+	// Loading a glyph writes the font page the frame in flight may be sampling
+	TextMesh::SetGlyphLoadBarrier([this]() { WaitIdle(); });
+}
+
+void RenderThread::Stop()
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	TextMesh::SetGlyphLoadBarrier(nullptr);
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_IsStopping = true;
+	}
+	m_FrameSubmitted.notify_one();
+	m_Thread.join();
+
+	if (m_Window->isOpen())
+	{
+		m_Window->setActive(true);
+	}
+}
+
+void RenderThread::Submit()
+{
+	if (!IsRunning())
+	{
+		if (m_Window != nullptr && m_Window->isOpen())
+		{
+			DrawFrame(m_Snapshots[m_BackIndex]);
+		}
+		return;
+	}
+
+	{
+		MOO_PROFILE_SCOPE("WaitForRenderThread");
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_FrameDrawn.wait(lock, [this]() { return !m_HasPendingFrame && !m_IsDrawing; });
+
+		m_FrontIndex = m_BackIndex;
+		m_HasPendingFrame = true;
+	}
+	m_FrameSubmitted.notify_one();
+
+	// The other snapshot was drawn already, it is free to record into
+	m_BackIndex = 1 - m_BackIndex;
+}
+
+void RenderThread::WaitIdle()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	m_FrameDrawn.wait(lock, [this]() { return !m_HasPendingFrame && !m_IsDrawing; });
+}
+
+void RenderThread::ThreadLoop()
+{
+	MOO_PROFILE_THREAD("Render");
+	m_Window->setActive(true);
+
+	while (true)
+	{
+		std::size_t frontIndex = 0;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_FrameSubmitted.wait(lock, [this]() { return m_IsStopping || m_HasPendingFrame; });
+
+			// Finish the frame already submitted before leaving
+			if (!m_HasPendingFrame)
+			{
+				break;
+			}
+
+			frontIndex = m_FrontIndex;
+			m_HasPendingFrame = false;
+			m_IsDrawing = true;
+		}
+
+		DrawFrame(m_Snapshots[frontIndex]);
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_IsDrawing = false;
+		}
+		m_FrameDrawn.notify_all();
+	}
+
+	m_Window->setActive(false);
+}
+
+void RenderThread::DrawFrame(const RenderSnapshot& snapshot)
+{
+	MOO_PROFILE_FUNCTION();
+	m_Window->clear();
+	snapshot.Submit(*m_Window);
+
+	// Includes the wait for vsync
+	MOO_PROFILE_SCOPE("Display");
+	m_Window->display();
+}
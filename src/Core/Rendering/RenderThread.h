@@ -0,0 +1,118 @@
+/*!
+ * \file RenderThread.h
+ *
+ * \brief Contains the RenderThread class, which owns the window's GL context and draws the frames the simulation
+ * publishes as RenderSnapshots.
+ *
+ * With rendering on the main thread, every frame waited for vsync in display() before the next tick could start.
+ * The main thread now only records a snapshot and hands it over; the render thread replays it and waits for vsync
+ * while the main thread already simulates and records the next frame.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "RenderSnapshot.h"
+
+/**
+ * @class RenderThread
+ * @brief Double-buffers RenderSnapshots between the main thread and a dedicated render thread.
+ *
+ * The main thread records into the back snapshot and calls Submit(), which waits until the render thread finished
+ * the previous frame before swapping. So at most one frame is drawn while the next is recorded, the main thread is
+ * never more than one frame ahead of the screen, and the snapshot being drawn is never written.
+ *
+ * Until Start() is called (and after Stop()), Submit() draws the snapshot on the calling thread instead.
+ */
+class RenderThread
+{
+public:
+	/**
+	 * @brief Constructs a stopped render thread.
+	 */
+	RenderThread();
+
+	/**
+	 * @brief Stops the thread if it is running.
+	 */
+	~RenderThread();
+
+	// Deleted copy constructor and assignment operator
+	RenderThread(const RenderThread&) = delete;
+	RenderThread& operator=(const RenderThread&) = delete;
+
+	/**
+	 * @brief Moves the window's GL context to a new render thread.
+	 *
+	 * While it runs, a TextMesh about to load new glyphs into a font first waits for the frame in flight.
+	 *
+	 * @param window The window to draw on; must outlive the thread.
+	 */
+	void Start(sf::RenderWindow& window);
+
+	/**
+	 * @brief Draws the last submitted frame, stops the thread and gives the GL context back to the calling thread.
+	 *
+	 * Must be called before the window is closed.
+	 */
+	void Stop();
+
+	/**
+	 * @brief Gets the snapshot the main thread records the next frame into.
+	 *
+	 * @return The back snapshot, left as the previous owner of this buffer filled it; Clear() it first.
+	 */
+	inline RenderSnapshot& GetBackSnapshot() { return m_Snapshots[m_BackIndex]; }
+
+	/**
+	 * @brief Publishes the back snapshot as the next frame to draw.
+	 *
+	 * Blocks until the render thread is done with the previous frame, then swaps the snapshots.
+	 */
+	void Submit();
+
+	/**
+	 * @brief Blocks until every submitted frame has been drawn.
+	 *
+	 * Call before destroying anything a recorded snapshot references, such as a scene's own texture.
+	 */
+	void WaitIdle();
+
+	// Getters
+
+	/**
+	 * @brief Checks whether frames are drawn on the render thread.
+	 *
+	 * @return True between Start() and Stop().
+	 */
+	inline bool IsRunning() const { return m_Thread.joinable(); }
+
+private:
+	/**
+	 * @brief Body of the render thread: draws every published snapshot until stopped.
+	 */
+	void ThreadLoop();
+
+	/**
+	 * @brief Clears the window, replays a snapshot and displays it, waiting for vsync.
+	 *
+	 * @param snapshot The frame to draw.
+	 */
+	void DrawFrame(const RenderSnapshot& snapshot);
+
+private:
+	sf::RenderWindow* m_Window;                ///< The window drawn on, nullptr until Start()
+	std::thread m_Thread;                      ///< The render thread, not joinable while stopped
+
+	std::array<RenderSnapshot, 2> m_Snapshots; ///< The frame being recorded and the frame being drawn
+	std::size_t m_BackIndex;                   ///< Snapshot the main thread records into, only touched by the main thread
+
+	std::mutex m_Mutex;                        ///< Guards every member below
+	std::condition_variable m_FrameSubmitted;  ///< Signalled when a frame is published or the thread stops
+	std::condition_variable m_FrameDrawn;      ///< Signalled when the render thread finished a frame
+	std::size_t m_FrontIndex;                  ///< Snapshot published to the render thread
+	bool m_HasPendingFrame;                    ///< A published frame the render thread has not picked up yet
+	bool m_IsDrawing;                          ///< The render thread is drawing the front snapshot
+	bool m_IsStopping;                         ///< Set by Stop() to release the thread
+};
@@ -0,0 +1,115 @@
+#include "stdafx.h"
+#include "SpriteBatch.h"
+#include "RenderSnapshot.h"
+
+void SpriteBatch::Begin()
+{
+	for (std::size_t i = 0; i < m_UsedGroups; ++i)
+	{
+		m_Groups[i].vertices.clear();
+	}
+
+	m_UsedGroups = 0;
+	m_PendingSprites = 0;
+}
+
+void SpriteBatch::Draw(const sf::Sprite& sprite)
+{
+	const sf::Texture* texture = sprite.getTexture();
+	if (texture == nullptr)
+	{
+		return;
+	}
+
+	// Transform the local corners of the sprite into world space
+	const sf::FloatRect local = sprite.getLocalBounds();
+	const sf::Transform& transform = sprite.getTransform();
+	const sf::Vector2f corners[4] =
+	{
+		transform.transformPoint(local.left, local.top),
+		transform.transformPoint(local.left + local.width, local.top),
+		transform.transformPoint(local.left + local.width, local.top + local.height),
+		transform.transformPoint(local.left, local.top + local.height)
+	};
+
+	AppendQuad(GetGroup(*texture).vertices, corners, sf::FloatRect(sprite.getTextureRect()), sprite.getColor());
+	++m_PendingSprites;
+}
+
+void SpriteBatch::Draw(const sf::Texture& texture, const sf::IntRect& textureRect, const Vector2f& position, const Vector2f& scale /*= { 1.0f, 1.0f }*/)
+{
+	const float width = static_cast<float>(std::abs(textureRect.width)) * scale.x;
+	const float height = static_cast<float>(std::abs(textureRect.height)) * scale.y;
+	const sf::Vector2f corners[4] =
+	{
+		sf::Vector2f(position.x, position.y),
+		sf::Vector2f(position.x + width, position.y),
+		sf::Vector2f(position.x + width, position.y + height),
+		sf::Vector2f(position.x, position.y + height)
+	};
+
+	AppendQuad(GetGroup(texture).vertices, corners, sf::FloatRect(textureRect), sf::Color::White);
+	++m_PendingSprites;
+}
+
+void SpriteBatch::End(RenderSnapshot& snapshot)
+{
+	m_DrawCalls = 0;
+	for (std::size_t i = 0; i < m_UsedGroups; ++i)
+	{
+		const Group& group = m_Groups[i];
+		if (group.vertices.getVertexCount() == 0)
+		{
+			continue;
+		}
+
+		snapshot.Draw(group.vertices, group.texture);
+		++m_DrawCalls;
+	}
+
+	m_SpriteCount = m_PendingSprites;
+}
+
+SpriteBatch::Group& SpriteBatch::GetGroup(const sf::Texture& texture)
+{
+	// Only a handful of textures are used per frame, a linear search beats hashing here
+	for (std::size_t i = 0; i < m_UsedGroups; ++i)
+	{
+		if (m_Groups[i].texture == &texture)
+		{
+			return m_Groups[i];
+		}
+	}
+
+	// Reuse a group from an earlier frame so its vertex array keeps its capacity
+	if (m_UsedGroups == m_Groups.size())
+	{
+		m_Groups.emplace_back();
+	}
+
+	Group& group = m_Groups[m_UsedGroups++];
+	group.texture = &texture;
+	group.vertices.clear();
+	return group;
+}
+
+void SpriteBatch::AppendQuad(sf::VertexArray& vertices, const sf::Vector2f (&corners)[4], const sf::FloatRect& textureRect, const sf::Color& color)
+{
+	const float left = textureRect.left;
+	const float top = textureRect.top;
+	const float right = textureRect.left + textureRect.width;
+	const float bottom = textureRect.top + textureRect.height;
+
+	const sf::Vertex topLeft(corners[0], color, sf::Vector2f(left, top));
+	const sf::Vertex topRight(corners[1], color, sf::Vector2f(right, top));
+	const sf::Vertex bottomRight(corners[2], color, sf::Vector2f(right, bottom));
+	const sf::Vertex bottomLeft(corners[3], color, sf::Vector2f(left, bottom));
+
+	// Two triangles sharing the top-left to bottom-right diagonal
+	vertices.append(topLeft);
+	vertices.append(topRight);
+	vertices.append(bottomRight);
+	vertices.append(topLeft);
+	vertices.append(bottomRight);
+	vertices.append(bottomLeft);
+}
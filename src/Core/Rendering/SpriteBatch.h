@@ -0,0 +1,123 @@
+/*!
+ * \file SpriteBatch.h
+ *
+ * \brief Contains the SpriteBatch class, which merges sprites sharing a texture into a single draw call.
+ *
+ * Drawing an sf::Sprite costs one draw call and one texture bind per sprite. The SpriteBatch instead appends each
+ * sprite as a textured quad (two triangles) to a vertex array owned by the sprite's texture, and submits every vertex
+ * array with one draw call in End(). The number of draw calls per frame therefore follows the number of distinct
+ * textures, not the number of entities.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+class RenderSnapshot;
+
+/**
+ * @class SpriteBatch
+ * @brief Collects textured quads grouped by texture and submits one draw call per texture.
+ *
+ * Typical usage per frame:
+ * - Begin()
+ * - Draw() every sprite
+ * - End() to record the groups into the frame's snapshot
+ *
+ * Groups are submitted in the order their texture was first used during the frame; sprites sharing a texture keep
+ * their submission order. Vertex arrays keep their capacity between frames, so steady-state batching does not allocate.
+ */
+class SpriteBatch
+{
+public:
+	/**
+	 * @brief Starts a new batch, discarding the quads of the previous frame.
+	 */
+	void Begin();
+
+	/**
+	 * @brief Adds a sprite to the batch, using its texture, texture rectangle, transform and color.
+	 *
+	 * Sprites without a texture are ignored.
+	 *
+	 * @param sprite The sprite to add.
+	 */
+	void Draw(const sf::Sprite& sprite);
+
+	/**
+	 * @brief Adds an axis-aligned textured quad to the batch.
+	 *
+	 * @param texture The texture to sample from.
+	 * @param textureRect The region of the texture to draw, in pixels.
+	 * @param position The world-space position of the quad's top-left corner.
+	 * @param scale The scale applied to the texture region's size.
+	 */
+	void Draw(const sf::Texture& texture, const sf::IntRect& textureRect, const Vector2f& position, const Vector2f& scale = { 1.0f, 1.0f });
+
+	/**
+	 * @brief Records every group into a snapshot, one draw call per texture.
+	 *
+	 * @param snapshot The frame being recorded.
+	 */
+	void End(RenderSnapshot& snapshot);
+
+	// Statistics of the last submitted batch
+
+	/**
+	 * @brief Gets the number of sprites submitted by the last End().
+	 *
+	 * @return The number of quads drawn.
+	 */
+	inline std::size_t GetSpriteCount() const { return m_SpriteCount; }
+
+	/**
+	 * @brief Gets the number of draw calls issued by the last End(), which is also the number of texture binds.
+	 *
+	 * @return The number of draw calls.
+	 */
+	inline std::size_t GetDrawCalls() const { return m_DrawCalls; }
+
+	/**
+	 * @brief Gets the number of draw calls saved by the last End() compared to drawing every sprite on its own.
+	 *
+	 * @return The number of sprites minus the number of draw calls.
+	 */
+	inline std::size_t GetDrawCallsSaved() const { return m_SpriteCount - m_DrawCalls; }
+
+private:
+	/**
+	 * @struct Group
+	 * @brief The quads sharing one texture.
+	 */
+	struct Group
+	{
+		const sf::Texture* texture = nullptr;                     ///< The texture every quad of the group samples
+		sf::VertexArray vertices{ sf::PrimitiveType::Triangles }; ///< Two triangles per quad
+	};
+
+	/**
+	 * @brief Finds the group of a texture, starting a new one if the texture was not used yet this frame.
+	 *
+	 * @param texture The texture to look up.
+	 * @return The group drawing with the texture.
+	 */
+	Group& GetGroup(const sf::Texture& texture);
+
+	/**
+	 * @brief Appends a quad as two triangles.
+	 *
+	 * @param vertices The vertex array to append to.
+	 * @param corners The four corners of the quad, clockwise from the top-left.
+	 * @param textureRect The region of the texture mapped onto the quad.
+	 * @param color The color the quad is modulated with.
+	 */
+	static void AppendQuad(sf::VertexArray& vertices, const sf::Vector2f (&corners)[4], const sf::FloatRect& textureRect, const sf::Color& color);
+
+private:
+	std::vector<Group> m_Groups;      ///< Every group ever used; only the first m_UsedGroups are live this frame
+	std::size_t m_UsedGroups = 0;     ///< Number of groups used since Begin()
+	std::size_t m_PendingSprites = 0; ///< Number of sprites added since Begin()
+
+	std::size_t m_SpriteCount = 0;    ///< Number of sprites submitted by the last End()
+	std::size_t m_DrawCalls = 0;      ///< Number of draw calls issued by the last End()
+};
@@ -0,0 +1,228 @@
+#include "stdafx.h"
+#include "TextMesh.h"
+
+// ********************* TEXT MESH CONSTANTS ********************
+constexpr float ITALIC_SHEAR = 0.209f; // 12 degrees, the slant sf::Text gives italic text
+constexpr float GLYPH_PADDING = 1.0f;  // Fonts leave one pixel around every glyph of a page, sf::Text samples it too
+// ****************************************************
+
+namespace
+{
+	/**
+	 * @struct GlyphKey
+	 * @brief Identifies one glyph of a font, the way sf::Font caches it.
+	 */
+	struct GlyphKey
+	{
+		const sf::Font* font = nullptr;
+		unsigned int characterSize = 0;
+		float outlineThickness = 0.0f;
+		sf::Uint32 codePoint = 0;
+		bool isBold = false;
+
+		bool operator==(const GlyphKey& other) const
+		{
+			return font == other.font && characterSize == other.characterSize && outlineThickness == other.outlineThickness
+				&& codePoint == other.codePoint && isBold == other.isBold;
+		}
+	};
+
+	/**
+	 * @struct GlyphKeyHash
+	 * @brief Hashes a GlyphKey for the unordered_set of loaded glyphs.
+	 */
+	struct GlyphKeyHash
+	{
+		std::size_t operator()(const GlyphKey& key) const
+		{
+			std::size_t hash = std::hash<const void*>()(key.font);
+			hash = hash * 31 + std::hash<unsigned int>()(key.characterSize);
+			hash = hash * 31 + std::hash<float>()(key.outlineThickness);
+			hash = hash * 31 + std::hash<sf::Uint32>()(key.codePoint);
+			return hash * 31 + (key.isBold ? 1 : 0);
+		}
+	};
+
+	// Only touched by the main thread, like the fonts themselves
+	std::unordered_set<GlyphKey, GlyphKeyHash> s_LoadedGlyphs; ///< Every glyph a TextMesh asked a font for
+	std::vector<GlyphKey> s_NewGlyphs;                          ///< Scratch of PrepareGlyphs(), keeps its capacity
+	std::function<void()> s_GlyphLoadBarrier;                   ///< Waits until no frame samples the fonts
+
+	/**
+	 * @brief Checks whether a character is laid out without a quad.
+	 */
+	bool IsWhitespace(sf::Uint32 character)
+	{
+		return character == L' ' || character == L'\n' || character == L'\t';
+	}
+
+	/**
+	 * @brief Appends the two triangles of one glyph, as sf::Text builds them.
+	 */
+	void AppendGlyphQuad(sf::VertexArray& vertices, const sf::Transform& transform, const sf::Vector2f& position,
+		const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+	{
+		const float left = glyph.bounds.left - GLYPH_PADDING;
+		const float top = glyph.bounds.top - GLYPH_PADDING;
+		const float right = glyph.bounds.left + glyph.bounds.width + GLYPH_PADDING;
+		const float bottom = glyph.bounds.top + glyph.bounds.height + GLYPH_PADDING;
+
+		const float u1 = static_cast<float>(glyph.textureRect.left) - GLYPH_PADDING;
+		const float v1 = static_cast<float>(glyph.textureRect.top) - GLYPH_PADDING;
+		const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + GLYPH_PADDING;
+		const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + GLYPH_PADDING;
+
+		const sf::Vector2f topLeft = transform.transformPoint(position.x + left - italicShear * top, position.y + top);
+		const sf::Vector2f topRight = transform.transformPoint(position.x + right - italicShear * top, position.y + top);
+		const sf::Vector2f bottomLeft = transform.transformPoint(position.x + left - italicShear * bottom, position.y + bottom);
+		const sf::Vector2f bottomRight = transform.transformPoint(position.x + right - italicShear * bottom, position.y + bottom);
+
+		vertices.append(sf::Vertex(topLeft, color, sf::Vector2f(u1, v1)));
+		vertices.append(sf::Vertex(topRight, color, sf::Vector2f(u2, v1)));
+		vertices.append(sf::Vertex(bottomLeft, color, sf::Vector2f(u1, v2)));
+		vertices.append(sf::Vertex(bottomLeft, color, sf::Vector2f(u1, v2)));
+		vertices.append(sf::Vertex(topRight, color, sf::Vector2f(u2, v1)));
+		vertices.append(sf::Vertex(bottomRight, color, sf::Vector2f(u2, v2)));
+	}
+}
+
+TextMesh::TextMesh()
+	: m_Vertices(sf::PrimitiveType::Triangles)
+	, m_Texture(nullptr)
+{
+}
+
+void TextMesh::Build(const sf::Text& text)
+{
+	m_Vertices.clear();
+	m_Texture = nullptr;
+
+	const sf::Font* font = text.getFont();
+	if (font == nullptr || text.getString().isEmpty())
+	{
+		return;
+	}
+
+	PrepareGlyphs(text);
+
+	if (text.getOutlineThickness() != 0.0f)
+	{
+		AppendGlyphs(text, text.getOutlineThickness(), text.getOutlineColor());
+	}
+	AppendGlyphs(text, 0.0f, text.getFillColor());
+
+	m_Texture = &font->getTexture(text.getCharacterSize());
+}
+
+void TextMesh::SetGlyphLoadBarrier(std::function<void()> barrier)
+{
+	s_GlyphLoadBarrier = std::move(barrier);
+}
+
+void TextMesh::PrepareGlyphs(const sf::Text& text)
+{
+	const sf::String& string = text.getString();
+	const bool isBold = (text.getStyle() & sf::Text::Bold) != 0;
+	const float outlineThickness = text.getOutlineThickness();
+
+	GlyphKey key;
+	key.font = text.getFont();
+	key.characterSize = text.getCharacterSize();
+	key.isBold = isBold;
+
+	// Every character is read without outline, at least by the kerning; the space always sets the whitespace width
+	auto require = [&key](sf::Uint32 codePoint, float thickness)
+		{
+			key.codePoint = codePoint;
+			key.outlineThickness = thickness;
+			if (s_LoadedGlyphs.find(key) == s_LoadedGlyphs.end())
+			{
+				s_NewGlyphs.push_back(key);
+			}
+		};
+
+	s_NewGlyphs.clear();
+	require(L' ', 0.0f);
+	for (std::size_t i = 0; i < string.getSize(); ++i)
+	{
+		const sf::Uint32 character = string[i];
+		if (character == L'\r')
+		{
+			continue;
+		}
+
+		require(character, 0.0f);
+		if (outlineThickness != 0.0f && !IsWhitespace(character))
+		{
+			require(character, outlineThickness);
+		}
+	}
+
+	if (s_NewGlyphs.empty())
+	{
+		return;
+	}
+
+	// The font is about to write its page textures, nothing may be drawing from them
+	if (s_GlyphLoadBarrier)
+	{
+		s_GlyphLoadBarrier();
+	}
+	s_LoadedGlyphs.insert(s_NewGlyphs.begin(), s_NewGlyphs.end());
+}
+
+void TextMesh::AppendGlyphs(const sf::Text& text, float outlineThickness, const sf::Color& color)
+{
+	// Same layout as sf::Text::ensureGeometryUpdate(), in the text's local space then transformed
+	const sf::Font& font = *text.getFont();
+	const sf::String& string = text.getString();
+	const unsigned int characterSize = text.getCharacterSize();
+	const bool isBold = (text.getStyle() & sf::Text::Bold) != 0;
+	const float italicShear = (text.getStyle() & sf::Text::Italic) != 0 ? ITALIC_SHEAR : 0.0f;
+	const sf::Transform& transform = text.getTransform();
+
+	float whitespaceWidth = font.getGlyph(L' ', characterSize, isBold).advance;
+	const float letterSpacing = (whitespaceWidth / 3.0f) * (text.getLetterSpacing() - 1.0f);
+	whitespaceWidth += letterSpacing;
+	const float lineSpacing = font.getLineSpacing(characterSize) * text.getLineSpacing();
+
+	float x = 0.0f;
+	float y = static_cast<float>(characterSize);
+	sf::Uint32 previous = 0;
+	for (std::size_t i = 0; i < string.getSize(); ++i)
+	{
+		const sf::Uint32 character = string[i];
+		if (character == L'\r')
+		{
+			continue;
+		}
+
+		x += font.getKerning(previous, character, characterSize, isBold);
+		previous = character;
+
+		if (IsWhitespace(character))
+		{
+			switch (character)
+			{
+			case L' ': x += whitespaceWidth; break;
+			case L'\t': x += whitespaceWidth * 4; break;
+			case L'\n': y += lineSpacing; x = 0.0f; break;
+			}
+			continue;
+		}
+
+		if (outlineThickness != 0.0f)
+		{
+			const sf::Glyph& outlineGlyph = font.getGlyph(character, characterSize, isBold, outlineThickness);
+			AppendGlyphQuad(m_Vertices, transform, sf::Vector2f(x, y), color, outlineGlyph, italicShear);
+		}
+
+		// Both passes advance by the fill glyph, like sf::Text
+		const sf::Glyph& glyph = font.getGlyph(character, characterSize, isBold);
+		if (outlineThickness == 0.0f)
+		{
+			AppendGlyphQuad(m_Vertices, transform, sf::Vector2f(x, y), color, glyph, italicShear);
+		}
+		x += glyph.advance + letterSpacing;
+	}
+}
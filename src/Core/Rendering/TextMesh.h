@@ -0,0 +1,93 @@
+/*!
+ * \file TextMesh.h
+ *
+ * \brief Contains the TextMesh class, which lays an sf::Text out into textured triangles on the main thread.
+ *
+ * An sf::Text reads its sf::Font while it is drawn: it looks the glyph page up in the font's page map and loads any
+ * missing glyph, which writes into the page texture. Replaying copies of live texts on the render thread raced with
+ * the main thread laying out the next frame against the same font. Texts are therefore recorded as TextMeshes: the
+ * same quads sf::Text would build, already transformed, plus the glyph page they sample. The render thread only ever
+ * sees vertices and a texture.
+ *
+ * Loading a glyph still writes the page texture the frame in flight may be sampling. TextMesh remembers every glyph it
+ * asked a font for, and before asking for a new one it calls the glyph load barrier, which the RenderThread sets to
+ * wait until the frame in flight is drawn. Once a text's characters were seen, laying it out never waits.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @class TextMesh
+ * @brief The glyph quads of a text, in world space, and the font page texture they sample.
+ *
+ * Typical usage:
+ * - Build() on the main thread whenever the text changed
+ * - RenderSnapshot::Draw(GetVertices(), GetTexture()) every frame
+ *
+ * Supports the Regular, Bold and Italic styles, the outline, letter and line spacing. Underlined and StrikeThrough
+ * lines are not drawn; no text of the game uses them.
+ */
+class TextMesh
+{
+public:
+	/**
+	 * @brief Constructs an empty mesh.
+	 */
+	TextMesh();
+
+	/**
+	 * @brief Lays a text out, replacing the previous mesh. Main thread only.
+	 *
+	 * The outline quads come first, then the fill quads, in the order sf::Text draws them.
+	 *
+	 * @param text The text, with its font, string, size, style, colors and transform.
+	 */
+	void Build(const sf::Text& text);
+
+	/**
+	 * @brief Sets the function called before a glyph is loaded into a font for the first time.
+	 *
+	 * @param barrier Must return once nothing samples the font textures; empty when nothing draws concurrently.
+	 */
+	static void SetGlyphLoadBarrier(std::function<void()> barrier);
+
+	// Getters
+
+	/**
+	 * @brief Gets the laid out quads, as a list of triangles.
+	 *
+	 * @return The vertices, empty if the text has no font or no visible character.
+	 */
+	inline const sf::VertexArray& GetVertices() const { return m_Vertices; }
+
+	/**
+	 * @brief Gets the glyph page texture the vertices sample.
+	 *
+	 * @return The texture, owned by the font; nullptr before the first Build() of a text with a font.
+	 */
+	inline const sf::Texture* GetTexture() const { return m_Texture; }
+
+private:
+	/**
+	 * @brief Calls the barrier if the text needs a glyph not yet loaded through a TextMesh, and remembers its glyphs.
+	 *
+	 * @param text The text about to be laid out.
+	 */
+	static void PrepareGlyphs(const sf::Text& text);
+
+	/**
+	 * @brief Appends the quads of one pass over the string.
+	 *
+	 * @param text The text.
+	 * @param outlineThickness The thickness of the glyphs to use, 0 for the fill pass.
+	 * @param color The color of the pass.
+	 */
+	void AppendGlyphs(const sf::Text& text, float outlineThickness, const sf::Color& color);
+
+private:
+	sf::VertexArray m_Vertices;    ///< The quads, two triangles each; keeps its capacity between builds
+	const sf::Texture* m_Texture;  ///< The glyph page of the text's font and size
+};
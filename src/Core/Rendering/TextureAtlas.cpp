@@ -0,0 +1,159 @@
+#include "stdafx.h"
+#include "TextureAtlas.h"
+#include "Core/Managers/AssetPack.h"
+
+TextureAtlas::TextureAtlas(unsigned int maxPageSize /*= 2048*/, unsigned int padding /*= 2*/)
+	: m_MaxPageSize(maxPageSize)
+	, m_Padding(padding)
+	, m_PageMemory(MemoryTag::TEXTURES)
+{
+}
+
+void TextureAtlas::Add(const std::string& name, const std::string& fileName)
+{
+	m_Pending.push_back({ name, fileName, sf::Image() });
+}
+
+void TextureAtlas::Add(const std::string& name, const sf::Image& image)
+{
+	m_Pending.push_back({ name, std::string(), image });
+}
+
+bool TextureAtlas::Build()
+{
+	Clear();
+
+	// Decode every image queued by path, dropping the ones that cannot be read
+	std::vector<PendingImage*> images;
+	images.reserve(m_Pending.size());
+	for (PendingImage& pending : m_Pending)
+	{
+		if (!pending.fileName.empty() && !AssetPack::Get().Load(pending.image, pending.fileName))
+		{
+			Log::Print("Failed to load atlas image", pending.fileName, LogLevel::ERROR_);
+			continue;
+		}
+
+		images.push_back(&pending);
+	}
+
+	// Tallest first keeps the shelves tight
+	std::stable_sort(images.begin(), images.end(), [](const PendingImage* a, const PendingImage* b)
+		{
+			return a->image.getSize().y > b->image.getSize().y;
+		});
+
+	const unsigned int pageSize = std::min(m_MaxPageSize, sf::Texture::getMaximumSize());
+	std::vector<sf::Vector2u> pageExtents;
+	Pack(images, pageSize, pageExtents);
+
+	// Compose every page on the CPU, then upload it once
+	std::vector<sf::Image> pageImages(pageExtents.size());
+	for (std::size_t page = 0; page < pageExtents.size(); ++page)
+	{
+		pageImages[page].create(pageExtents[page].x, pageExtents[page].y, sf::Color::Transparent);
+	}
+
+	for (const PendingImage* pending : images)
+	{
+		auto it = m_Regions.find(pending->name);
+		if (it != m_Regions.end())
+		{
+			const AtlasRegion& region = it->second;
+			pageImages[region.page].copy(pending->image, static_cast<unsigned int>(region.rect.left), static_cast<unsigned int>(region.rect.top));
+		}
+	}
+
+	for (const sf::Image& pageImage : pageImages)
+	{
+		std::shared_ptr<sf::Texture> texture = std::make_shared<sf::Texture>();
+		if (!texture->loadFromImage(pageImage))
+		{
+			Log::Print("Failed to upload atlas page", m_Pages.size(), LogLevel::ERROR_);
+		}
+
+		m_Pages.push_back(texture);
+	}
+
+	std::size_t pageBytes = 0;
+	for (const std::shared_ptr<sf::Texture>& page : m_Pages)
+	{
+		pageBytes += static_cast<std::size_t>(page->getSize().x) * page->getSize().y * 4;
+	}
+	m_PageMemory.Resize(pageBytes);
+
+	// The decoded images are no longer needed
+	m_Pending.clear();
+
+	Log::Print("Atlas regions packed", m_Regions.size());
+	Log::Print("Atlas pages created", m_Pages.size());
+	return !m_Pages.empty();
+}
+
+void TextureAtlas::Clear()
+{
+	m_Pages.clear();
+	m_Regions.clear();
+	m_PageMemory.Resize(0);
+}
+
+const AtlasRegion* TextureAtlas::FindRegion(const std::string& name) const
+{
+	auto it = m_Regions.find(name);
+	return (it != m_Regions.end()) ? &it->second : nullptr;
+}
+
+void TextureAtlas::Pack(const std::vector<PendingImage*>& images, unsigned int pageSize, std::vector<sf::Vector2u>& outPageExtents)
+{
+	unsigned int cursorX = m_Padding;     // Next free column on the current shelf
+	unsigned int shelfY = m_Padding;      // Top of the current shelf
+	unsigned int shelfHeight = 0;         // Height of the tallest image on the current shelf
+
+	for (const PendingImage* pending : images)
+	{
+		const unsigned int width = pending->image.getSize().x;
+		const unsigned int height = pending->image.getSize().y;
+
+		if (width + 2 * m_Padding > pageSize || height + 2 * m_Padding > pageSize)
+		{
+			Log::Print("Image too large for an atlas page", pending->name, LogLevel::ERROR_);
+			continue;
+		}
+
+		// Start the first page lazily so an empty atlas has no pages
+		if (outPageExtents.empty())
+		{
+			outPageExtents.emplace_back(0, 0);
+		}
+
+		// Not enough room left on this shelf: open a new one below it
+		if (cursorX + width + m_Padding > pageSize)
+		{
+			shelfY += shelfHeight + m_Padding;
+			cursorX = m_Padding;
+			shelfHeight = 0;
+		}
+
+		// Not enough room left on this page: open a new page
+		if (shelfY + height + m_Padding > pageSize)
+		{
+			outPageExtents.emplace_back(0, 0);
+			cursorX = m_Padding;
+			shelfY = m_Padding;
+			shelfHeight = 0;
+		}
+
+		AtlasRegion region;
+		region.page = outPageExtents.size() - 1;
+		region.rect = sf::IntRect(static_cast<int>(cursorX), static_cast<int>(shelfY), static_cast<int>(width), static_cast<int>(height));
+		m_Regions[pending->name] = region;
+
+		// Grow the used area of the page so it can be trimmed when composed
+		sf::Vector2u& extent = outPageExtents.back();
+		extent.x = std::max(extent.x, cursorX + width + m_Padding);
+		extent.y = std::max(extent.y, shelfY + height + m_Padding);
+
+		cursorX += width + m_Padding;
+		shelfHeight = std::max(shelfHeight, height);
+	}
+}
@@ -0,0 +1,142 @@
+/*!
+ * \file TextureAtlas.h
+ *
+ * \brief Contains the AtlasRegion struct and the TextureAtlas class, which packs many small images into few textures.
+ *
+ * Every separate texture costs a texture bind when drawn, and the SpriteBatch can only merge quads that sample the
+ * same texture. The TextureAtlas loads a list of images, packs them into large pages with a shelf packer (tallest
+ * images first) and uploads each page as one texture. Images are then referenced by name as a page plus a sub-rect.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "Core/Memory/MemoryTracker.h"
+
+/**
+ * @struct AtlasRegion
+ * @brief The location of one packed image inside an atlas.
+ */
+struct AtlasRegion
+{
+	std::size_t page = 0; ///< Index of the page holding the image
+	sf::IntRect rect;     ///< Pixel rectangle of the image inside the page
+};
+
+/**
+ * @class TextureAtlas
+ * @brief Packs images into texture pages at startup and looks up their regions by name.
+ *
+ * Typical usage:
+ * - Add() every image
+ * - Build() once, which decodes, packs and uploads everything
+ * - FindRegion() / GetPage() to draw
+ *
+ * Images are separated by transparent padding so neighbours never bleed into each other when a sprite lands on a
+ * fractional position. Pages are trimmed to the area actually used.
+ */
+class TextureAtlas
+{
+public:
+	/**
+	 * @brief Constructs an empty atlas.
+	 *
+	 * @param maxPageSize The maximum width and height of a page; clamped to what the GPU supports.
+	 * @param padding The transparent gap kept around every image, in pixels.
+	 */
+	explicit TextureAtlas(unsigned int maxPageSize = 2048, unsigned int padding = 2);
+
+	/**
+	 * @brief Queues an image to be packed by the next Build().
+	 *
+	 * @param name The name the region is looked up with.
+	 * @param fileName The path of the image file.
+	 */
+	void Add(const std::string& name, const std::string& fileName);
+
+	/**
+	 * @brief Queues an image that is already decoded, for example by the AssetLoader, to be packed by the next Build().
+	 *
+	 * @param name The name the region is looked up with.
+	 * @param image The decoded pixels, copied into the atlas.
+	 */
+	void Add(const std::string& name, const sf::Image& image);
+
+	/**
+	 * @brief Decodes every queued file, packs all queued images into pages and uploads the pages to the GPU.
+	 *
+	 * Images that fail to load or do not fit in a page are logged and skipped. Called on the main thread, possibly while
+	 * the render thread draws a frame: the pages are uploaded through SFML's hidden context, shared with the window's.
+	 *
+	 * @return True if at least one page was created.
+	 */
+	bool Build();
+
+	/**
+	 * @brief Removes every page and region.
+	 */
+	void Clear();
+
+	/**
+	 * @brief Finds the region of a packed image.
+	 *
+	 * @param name The name the image was added with.
+	 * @return The region, or nullptr if no image with that name was packed.
+	 */
+	const AtlasRegion* FindRegion(const std::string& name) const;
+
+	// Getters
+
+	/**
+	 * @brief Gets a page texture.
+	 *
+	 * @param index The page index, as stored in an AtlasRegion.
+	 * @return A shared handle to the page texture.
+	 */
+	inline const std::shared_ptr<sf::Texture>& GetPage(std::size_t index) const { return m_Pages[index]; }
+
+	/**
+	 * @brief Gets the number of pages created by the last Build().
+	 *
+	 * @return The page count.
+	 */
+	inline std::size_t GetPageCount() const { return m_Pages.size(); }
+
+	/**
+	 * @brief Gets the number of images packed by the last Build().
+	 *
+	 * @return The region count.
+	 */
+	inline std::size_t GetRegionCount() const { return m_Regions.size(); }
+
+private:
+	/**
+	 * @struct PendingImage
+	 * @brief An image queued with Add(), waiting for Build().
+	 */
+	struct PendingImage
+	{
+		std::string name;     ///< The name the region will be looked up with
+		std::string fileName; ///< The path of the image file, empty if the image was added decoded
+		sf::Image image;      ///< The decoded pixels, filled by Build() when added by path
+	};
+
+	/**
+	 * @brief Assigns a page and position to every decoded image using shelf packing.
+	 *
+	 * @param images The decoded images, sorted tallest first.
+	 * @param pageSize The width and height available on a page.
+	 * @param outPageExtents The used width and height of every page.
+	 */
+	void Pack(const std::vector<PendingImage*>& images, unsigned int pageSize, std::vector<sf::Vector2u>& outPageExtents);
+
+private:
+	unsigned int m_MaxPageSize; ///< Requested maximum page size, before clamping to the GPU limit
+	unsigned int m_Padding;     ///< Transparent gap around every image
+
+	std::vector<PendingImage> m_Pending;                      ///< Images queued for the next Build()
+	std::vector<std::shared_ptr<sf::Texture>> m_Pages;        ///< The uploaded page textures
+	std::unordered_map<std::string, AtlasRegion> m_Regions;   ///< Packed regions by name
+	TrackedMemory m_PageMemory;                               ///< Video memory of the pages, reported as textures
+};
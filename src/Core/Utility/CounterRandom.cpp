@@ -0,0 +1,32 @@
+#include "stdafx.h"
+#include "CounterRandom.h"
+
+void CounterRandom::SetSeed(std::uint64_t seed)
+{
+	m_Seed = seed;
+
+	// SplitMix64 finalizer: neighbouring seeds (1, 2, 3...) still give unrelated keys
+	std::uint64_t key = seed + 0x9E3779B97F4A7C15ull;
+	key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ull;
+	key = (key ^ (key >> 27)) * 0x94D049BB133111EBull;
+	key = key ^ (key >> 31);
+
+	// Squares needs an odd key
+	m_Key = key | 1;
+}
+
+void CounterRandom::GenerateInts(const std::uint32_t* entityIds, std::size_t count, std::uint32_t tick, std::uint32_t draw, int min, int max, int* outValues) const
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		outValues[i] = ToInt(Squares32(MakeCounter(entityIds[i], tick, draw), m_Key), min, max);
+	}
+}
+
+void CounterRandom::GenerateFloats(const std::uint32_t* entityIds, std::size_t count, std::uint32_t tick, std::uint32_t draw, float min, float max, float* outValues) const
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		outValues[i] = ToFloat(Squares32(MakeCounter(entityIds[i], tick, draw), m_Key), min, max);
+	}
+}
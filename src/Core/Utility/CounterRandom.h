@@ -0,0 +1,196 @@
+/*!
+ * \file CounterRandom.h
+ *
+ * \brief Contains the CounterRandom class, a stateless counter-based random generator giving every entity its own
+ * reproducible stream.
+ *
+ * A classic engine (std::default_random_engine) is a sequence: each value depends on every value drawn before, so
+ * entities sharing it must draw in a fixed order, and entities owning a copy carry its whole state. A counter-based
+ * generator instead hashes a counter with a key: the value for (seed, entity, tick, draw) is always the same, no
+ * matter which thread asks, in which order, or how many other values were drawn. The only state is the 64-bit key.
+ *
+ * The hash is Widynski's "Squares" generator: four rounds of squaring a 64-bit word and swapping its halves.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @class CounterRandom
+ * @brief Maps (entity id, tick, draw index) to uniformly distributed values, for a given seed.
+ *
+ * Every entity owns an independent stream keyed by its id; within a tick it may take up to DRAWS_PER_TICK values by
+ * using different draw indices (one per kind of decision, for example spawn delay and shot roll). Asking twice for
+ * the same (entity, tick, draw) returns the same value, which is what makes replays and parallel updates
+ * deterministic.
+ */
+class CounterRandom
+{
+public:
+	static constexpr std::uint32_t DRAWS_PER_TICK = 8; ///< Distinct draw indices available to an entity in one tick
+
+	/**
+	 * @brief Constructs a generator for a seed.
+	 *
+	 * @param seed The seed every stream derives from.
+	 */
+	explicit CounterRandom(std::uint64_t seed = 0)
+	{
+		SetSeed(seed);
+	}
+
+	/**
+	 * @brief Changes the seed, which changes every stream.
+	 *
+	 * @param seed The seed every stream derives from.
+	 */
+	void SetSeed(std::uint64_t seed);
+
+	/**
+	 * @brief Gets a raw 32-bit value of an entity's stream.
+	 *
+	 * @param entityId The stable id of the entity.
+	 * @param tick The simulation tick.
+	 * @param draw Which value of the tick, below DRAWS_PER_TICK.
+	 * @return A uniformly distributed 32-bit value.
+	 */
+	inline std::uint32_t GetUint(std::uint32_t entityId, std::uint32_t tick, std::uint32_t draw = 0) const
+	{
+		return Squares32(MakeCounter(entityId, tick, draw), m_Key);
+	}
+
+	/**
+	 * @brief Gets an integer of an entity's stream in the range [min, max].
+	 *
+	 * @param entityId The stable id of the entity.
+	 * @param tick The simulation tick.
+	 * @param min The smallest value.
+	 * @param max The largest value.
+	 * @param draw Which value of the tick, below DRAWS_PER_TICK.
+	 * @return An integer between min and max, inclusive.
+	 */
+	inline int GetInt(std::uint32_t entityId, std::uint32_t tick, int min, int max, std::uint32_t draw = 0) const
+	{
+		return ToInt(GetUint(entityId, tick, draw), min, max);
+	}
+
+	/**
+	 * @brief Gets a float of an entity's stream in the range [min, max).
+	 *
+	 * @param entityId The stable id of the entity.
+	 * @param tick The simulation tick.
+	 * @param min The smallest value.
+	 * @param max The upper bound, never returned.
+	 * @param draw Which value of the tick, below DRAWS_PER_TICK.
+	 * @return A float between min and max.
+	 */
+	inline float GetFloat(std::uint32_t entityId, std::uint32_t tick, float min, float max, std::uint32_t draw = 0) const
+	{
+		return ToFloat(GetUint(entityId, tick, draw), min, max);
+	}
+
+	/**
+	 * @brief Draws one integer for each of many entities at once.
+	 *
+	 * The loop has no dependency between iterations, so the compiler can vectorize it.
+	 *
+	 * @param entityIds The ids of the entities.
+	 * @param count The number of entities.
+	 * @param tick The simulation tick.
+	 * @param draw Which value of the tick, below DRAWS_PER_TICK.
+	 * @param min The smallest value.
+	 * @param max The largest value.
+	 * @param outValues Receives count integers between min and max, inclusive.
+	 */
+	void GenerateInts(const std::uint32_t* entityIds, std::size_t count, std::uint32_t tick, std::uint32_t draw, int min, int max, int* outValues) const;
+
+	/**
+	 * @brief Draws one float for each of many entities at once.
+	 *
+	 * @param entityIds The ids of the entities.
+	 * @param count The number of entities.
+	 * @param tick The simulation tick.
+	 * @param draw Which value of the tick, below DRAWS_PER_TICK.
+	 * @param min The smallest value.
+	 * @param max The upper bound, never returned.
+	 * @param outValues Receives count floats between min and max.
+	 */
+	void GenerateFloats(const std::uint32_t* entityIds, std::size_t count, std::uint32_t tick, std::uint32_t draw, float min, float max, float* outValues) const;
+
+	// Getters
+
+	/**
+	 * @brief Gets the seed the streams derive from.
+	 *
+	 * @return The seed.
+	 */
+	inline std::uint64_t GetSeed() const { return m_Seed; }
+
+private:
+	/**
+	 * @brief Packs an entity id, a tick and a draw index into the 64-bit counter.
+	 *
+	 * The id fills the high half; the low half counts draws, which wraps after 2^29 ticks (about 52 days at 120 Hz).
+	 *
+	 * @param entityId The stable id of the entity.
+	 * @param tick The simulation tick.
+	 * @param draw Which value of the tick.
+	 * @return The counter to hash.
+	 */
+	static inline std::uint64_t MakeCounter(std::uint32_t entityId, std::uint32_t tick, std::uint32_t draw)
+	{
+		const std::uint32_t drawIndex = tick * DRAWS_PER_TICK + (draw % DRAWS_PER_TICK);
+		return (static_cast<std::uint64_t>(entityId) << 32) | drawIndex;
+	}
+
+	/**
+	 * @brief The Squares hash: four rounds of square, add and swap halves.
+	 *
+	 * @param counter The counter.
+	 * @param key The key derived from the seed.
+	 * @return A uniformly distributed 32-bit value.
+	 */
+	static inline std::uint32_t Squares32(std::uint64_t counter, std::uint64_t key)
+	{
+		std::uint64_t x = counter * key;
+		const std::uint64_t y = x;
+		const std::uint64_t z = y + key;
+		x = x * x + y; x = (x >> 32) | (x << 32);
+		x = x * x + z; x = (x >> 32) | (x << 32);
+		x = x * x + y; x = (x >> 32) | (x << 32);
+		return static_cast<std::uint32_t>((x * x + z) >> 32);
+	}
+
+	/**
+	 * @brief Scales a 32-bit value to [min, max] with a multiply instead of a modulo.
+	 *
+	 * @param value The raw value.
+	 * @param min The smallest value.
+	 * @param max The largest value.
+	 * @return The scaled integer.
+	 */
+	static inline int ToInt(std::uint32_t value, int min, int max)
+	{
+		const std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+		return min + static_cast<int>((value * range) >> 32);
+	}
+
+	/**
+	 * @brief Scales a 32-bit value to [min, max), keeping the 24 bits a float can hold.
+	 *
+	 * @param value The raw value.
+	 * @param min The smallest value.
+	 * @param max The upper bound.
+	 * @return The scaled float.
+	 */
+	static inline float ToFloat(std::uint32_t value, float min, float max)
+	{
+		return min + (max - min) * (static_cast<float>(value >> 8) * (1.0f / 16777216.0f));
+	}
+
+private:
+	std::uint64_t m_Seed; ///< The seed the key was derived from
+	std::uint64_t m_Key;  ///< Squares key: the seed mixed so its bits are well spread, forced odd
+};
@@ -1,11 +1,12 @@
 #include "stdafx.h"
 #include "GameplayUtility.h"
 #include "Entities/Spaceship.h"
-#include "Entities/Enemy.h"
-#include "Entities/Projectile.h"
+#include "Entities/EnemyStore.h"
+#include "Entities/ProjectilePool.h"
+#include "SpatialHashGrid.h"
 
 // Spawns a specified number of enemies and positions them in a grid formation.
-void GameplayUtility::EnemySpawner(std::vector<std::unique_ptr<Enemy>>& enemies, const std::string& enemyFile, const std::string& projectileFile, DifficultyLevel difficultyLevel, RandomGenerator rng, int numberOfEnemies, int rows, int columns, int xSpacing, int ySpacing)
+void GameplayUtility::EnemySpawner(EnemyStore& enemies, DifficultyLevel difficultyLevel, int numberOfEnemies, int rows, int columns, int xSpacing, int ySpacing)
 {
 	// Validate input parameters. Exit if any parameter is invalid.
 	if (numberOfEnemies <= 0 || rows <= 0 || columns <= 0 || xSpacing <= 0 || ySpacing <= 0)
@@ -17,8 +18,8 @@ void GameplayUtility::EnemySpawner(std::vector<std::unique_ptr<Enemy>>& enemies,
 	// Adjust the number of rows needed to fit all the enemies
 	rows = (numberOfEnemies + columns - 1) / columns;
 
-	// Reserve space in the vector to improve performance
-	enemies.reserve(numberOfEnemies); // Reserve memory for efficiency
+	// Reserve space in the store's arrays to improve performance
+	enemies.Reserve(enemies.Size() + numberOfEnemies); // Reserve memory for efficiency
 	int index = 0;
 
 	// Loop through the grid positions (rows and columns) and spawn enemies
@@ -29,18 +30,12 @@ void GameplayUtility::EnemySpawner(std::vector<std::unique_ptr<Enemy>>& enemies,
 			// If the number of enemies already spawned reaches the desired number, exit the loop
 			if (index >= numberOfEnemies) return;  // Stop if we reached the desired number of enemies
 
-			// Create a new enemy based on the difficulty level and RNG for variation
-			std::unique_ptr<Enemy> enemy = std::make_unique<Enemy>(enemyFile, projectileFile, difficultyLevel, rng);
-
 			// Calculate the position of the enemy in the grid
 			float xPos = static_cast<float>(x * xSpacing);
 			float yPos = static_cast<float>(y * ySpacing);
 
-			// Set the position of the newly created enemy
-			enemy->SetPosition(Vector2f(xPos, yPos));  // Set position based on the grid
-
-			// Add the enemy to the vector of enemies
-			enemies.emplace_back(std::move(enemy));  // Add to the vector
+			// Add the enemy to the store, with a random first shot delay for variation
+			enemies.Spawn(Vector2f(xPos, yPos), difficultyLevel);
 
 			// Increment the index
 			++index;
@@ -49,89 +44,79 @@ void GameplayUtility::EnemySpawner(std::vector<std::unique_ptr<Enemy>>& enemies,
 }
 
 // Checks for collisions between enemies and projectiles, and handles their interaction
-void GameplayUtility::CheckEnemyCollision(std::vector<std::unique_ptr<Enemy>>& enemies, std::vector<std::unique_ptr<Projectile>>& projectiles)
+void GameplayUtility::CheckEnemyCollision(EnemyStore& enemies, ProjectilePool& projectiles, SpatialHashGrid& enemyGrid)
 {
-	// Iterate over all projectiles to check for collisions
+	// Rebuild the broadphase from the enemies' current hitboxes
+	enemyGrid.Rebuild(enemies.Size(), [&enemies](std::size_t i, sf::FloatRect& outBounds)
+		{
+			// Skip dead enemies
+			if (!enemies.IsAlive(i))
+			{
+				return false;
+			}
+
+			outBounds = enemies.GetBounds(i);
+			return true;
+		});
+
+	bool hasKilledEnemy = false;
+
+	// Iterate over all projectiles and only test them against the enemies sharing their cells
 	for (auto& projectile : projectiles)
 	{
 		// Skip inactive projectiles (those not currently in use)
-		if (!projectile->IsProjectileActive())
+		if (!projectile.IsProjectileActive())
 		{
-			// Skip inactive projectiles
 			continue;
 		}
 
 		// Get the global bounding box of the projectile
-		sf::FloatRect projBounds = projectile->GetBounds();
-
-		// Iterate over the enemies to check for collisions with each
-		for (auto it = enemies.begin(); it != enemies.end(); /* no increment here */)
-		{
-			auto& enemy = *it;
-
-			// Skip dead enemies
-			if (!enemy->IsAlive())
-			{
-				++it;
-				continue;
-			}
+		sf::FloatRect projBounds = projectile.GetBounds();
 
-			sf::FloatRect enemyBounds = enemy->GetSprite().getGlobalBounds();
-			if (projBounds.intersects(enemyBounds))  // Check for intersection
+		enemyGrid.Query(projBounds, [&](std::uint32_t enemyIndex, const sf::FloatRect& enemyBounds)
 			{
-				enemy->SetStatus(false);  // Mark enemy as dead
-				projectile->SetStatus(false);  // Deactivate projectile
-
-				// Remove dead enemy from the vector using a lambda
-				it = std::remove_if(enemies.begin(), enemies.end(), [](const std::unique_ptr<Enemy>& enemy)
-					{
-						return !enemy->IsAlive();
-					});
-				enemies.erase(it, enemies.end());  // Erase the dead enemies
+				// Skip enemies already killed earlier in this pass
+				if (!enemies.IsAlive(enemyIndex) || !projBounds.intersects(enemyBounds))
+				{
+					return false;
+				}
+
+				enemies.Kill(enemyIndex);       // Mark enemy as dead
+				projectile.SetStatus(false);    // Deactivate projectile
+				hasKilledEnemy = true;
+				return true;  // Once collision is detected, no need to check further for this projectile
+			});
+	}
 
-				break;  // Once collision is detected, no need to check further for this projectile
-			}
-			else
-			{
-				++it;  // Only increment the iterator if the enemy is not dead
-			}
-		}
+	// Remove every enemy killed during the pass in one go
+	if (hasKilledEnemy)
+	{
+		enemies.RemoveDead();
 	}
 }
 
 // Checks if any projectiles fired by enemies hit the spaceship, and handles the impact
-bool GameplayUtility::HasEnemyProjectileHitSpaceship(std::vector<std::unique_ptr<Enemy>>& enemies, Spaceship& spaceship)
+bool GameplayUtility::HasEnemyProjectileHitSpaceship(EnemyStore& enemies, Spaceship& spaceship)
 {
 	// Get the global bounding box of the spaceship
 	const sf::FloatRect& spaceshipHitbox = spaceship.GetSprite().getGlobalBounds();
 
-	// Iterate over the enemies
-	for (auto& enemy : enemies)
+	// Iterate over all projectiles fired by the enemies
+	for (auto& projectile : enemies.GetProjectiles())
 	{
-		// Skip dead enemies
-		if (!enemy->IsAlive())
+		// Skip inactive projectiles
+		if (!projectile.GetStatus())
 		{
 			continue;
 		}
 
-		// Iterate over all projectiles fired by the enemy
-		auto& projectiles = enemy->GetProjectiles();
-		for (auto& projectile : projectiles)
+		// Check if the projectile intersects with the spaceship's hitbox
+		if (projectile.GetBounds().intersects(spaceshipHitbox))
 		{
-			// Skip inactive projectiles
-			if (!projectile->GetStatus())
-			{
-				continue;
-			}
-
-			// Check if the projectile intersects with the spaceship's hitbox
-			if (projectile->GetBounds().intersects(spaceshipHitbox))
-			{
-				// If the spaceship is hit, trigger the spaceship's OnHit function (damage/death)
-				spaceship.OnHit();                   // Trigger damage/death
-				projectile->SetStatus(false);         // Mark for removal
-				return true; // Once a hit is detected, no need to check further for this projectile
-			}
+			// If the spaceship is hit, trigger the spaceship's OnHit function (damage/death)
+			spaceship.OnHit();                   // Trigger damage/death
+			projectile.SetStatus(false);          // Mark for removal
+			return true; // Once a hit is detected, no need to check further for this projectile
 		}
 	}
 
@@ -139,16 +124,20 @@ bool GameplayUtility::HasEnemyProjectileHitSpaceship(std::vector<std::unique_ptr
 }
 
 // Removes inactive projectiles from the list of projectiles
-void GameplayUtility::RemoveInactiveProjectiles(std::vector<std::unique_ptr<Projectile>>& projectiles)
+void GameplayUtility::RemoveInactiveProjectiles(ProjectilePool& projectiles)
+{
+	// Swap-and-pop every inactive projectile back into the pool's free slots
+	projectiles.RemoveInactive();
+}
+
+// Spawns a projectile from the pool's free slots
+void GameplayUtility::SpawnProjectile(ProjectilePool& projectiles, const Vector2f& startingPosition, const Vector2f direction)
 {
-	// Remove all projectiles that are inactive from the vector using a lambda function
-	projectiles.erase(std::remove_if(projectiles.begin(), projectiles.end(),
-		[](const std::unique_ptr<Projectile>& p) { return !p->IsProjectileActive(); }),
-		projectiles.end());
+	projectiles.Spawn(startingPosition, direction);
 }
 
 // Attempts to shoot a projectile with a random cooldown. If the random roll succeeds, the projectile is spawned.
-void GameplayUtility::TryShootWithRandomCooldown(std::vector<std::unique_ptr<Projectile>>& projectiles, float deltaTime, const std::string& projectileFile, const Vector2f& spawnPos, const Vector2f& direction, float& shootCooldown, int maxRollValue, int requiredRollToShoot, float resetCooldownTime, RandomGenerator& rng)
+void GameplayUtility::TryShootWithRandomCooldown(ProjectilePool& projectiles, float deltaTime, const Vector2f& spawnPos, const Vector2f& direction, float& shootCooldown, int maxRollValue, int requiredRollToShoot, float resetCooldownTime, RandomGenerator& rng)
 {
 	// Reduce the cooldown by the time passed since the last frame
 	shootCooldown -= deltaTime;
@@ -164,7 +153,7 @@ void GameplayUtility::TryShootWithRandomCooldown(std::vector<std::unique_ptr<Pro
 	if (roll <= requiredRollToShoot)
 	{
 		// Shoot a new projectile if the random roll is successful
-		projectiles.emplace_back(std::make_unique<Projectile>(projectileFile, spawnPos, direction));
+		projectiles.Spawn(spawnPos, direction);
 
 		// Reset the cooldown after shooting
 		shootCooldown = resetCooldownTime;
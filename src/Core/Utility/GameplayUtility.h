@@ -12,8 +12,9 @@
 
 // Forward declarations
 class Spaceship;
-class Projectile;
-class Enemy;
+class ProjectilePool;
+class SpatialHashGrid;
+class EnemyStore;
 enum class DifficultyLevel;
 
 
@@ -24,30 +25,31 @@ namespace GameplayUtility
    *
    * This function spawns enemies at specific positions in the grid based on the difficulty level.
    * The number of rows and columns are calculated to fit the required number of enemies.
-   * Each enemy is assigned a random generator for unique properties.
+   * Each enemy draws a random delay before its first shot from the store's own streams, see EnemyStore::Spawn().
    *
-   * @param enemies The vector of unique pointers to the enemy objects.
+   * @param enemies The store the enemies are added to.
    * @param difficultyLevel The current difficulty level for the enemies.
-   * @param rng Random number generator for enemy behavior.
    * @param numberOfEnemies Total number of enemies to spawn.
    * @param rows Number of rows in the grid.
    * @param columns Number of columns in the grid.
    * @param xSpacing Horizontal spacing between enemies.
    * @param ySpacing Vertical spacing between enemies.
    */
-	void EnemySpawner(std::vector<std::unique_ptr<Enemy>>& enemies, const std::string& enemyFile, const std::string& projectileFile, DifficultyLevel difficultyLevel, RandomGenerator rng, int numberOfEnemies, int rows, int columns, int xSpacing, int ySpacing);
+	void EnemySpawner(EnemyStore& enemies, DifficultyLevel difficultyLevel, int numberOfEnemies, int rows, int columns, int xSpacing, int ySpacing);
 
 
 	/**
 	 * @brief Checks for collisions between projectiles and enemies.
 	 *
-	 * Iterates over all projectiles and checks if they intersect with any of the enemies.
-	 * When a collision is detected, the projectile and cow are deactivated, and the cow is removed from the game.
+	 * Rebuilds the enemy broadphase grid, then tests each projectile only against the enemies sharing its grid cells.
+	 * When a collision is detected, the projectile and cow are deactivated. Dead cows are removed from the game once,
+	 * at the end of the pass.
 	 *
-	 * @param enemies The vector of unique pointers to enemy enemies.
-	 * @param projectiles The vector of unique pointers to projectile objects.
+	 * @param enemies The store holding every enemy of the level.
+	 * @param projectiles The pool holding the player's projectiles.
+	 * @param enemyGrid The grid reused every tick to hash the enemies' hitboxes.
 	 */
-	void CheckEnemyCollision(std::vector<std::unique_ptr<Enemy>>& enemies, std::vector<std::unique_ptr<Projectile>>& projectiles);
+	void CheckEnemyCollision(EnemyStore& enemies, ProjectilePool& projectiles, SpatialHashGrid& enemyGrid);
 
 	    /**
      * @brief Checks if any cow projectiles hit the spaceship.
@@ -55,44 +57,39 @@ namespace GameplayUtility
      * Iterates over all enemies' projectiles and checks if they intersect with the spaceship.
      * If a collision is detected, the spaceship takes damage and the projectile is deactivated.
      *
-     * @param enemies The vector of unique pointers to enemy enemies.
+     * @param enemies The store holding every enemy and their projectiles.
      * @param spaceship The spaceship object to check for collisions.
      */
-	bool HasEnemyProjectileHitSpaceship(std::vector<std::unique_ptr<Enemy>>& enemies, Spaceship& spaceship);
+	bool HasEnemyProjectileHitSpaceship(EnemyStore& enemies, Spaceship& spaceship);
 
 	  /**
      * @brief Removes inactive projectiles from the game.
      *
-     * Iterates through the projectiles and removes those that are no longer active.
+     * Iterates through the projectiles and returns those that are no longer active to the pool's free list.
      *
-     * @param projectiles The vector of unique pointers to projectile objects.
+     * @param projectiles The pool holding the projectiles.
      */
-	void RemoveInactiveProjectiles(std::vector<std::unique_ptr<Projectile>>& projectiles);
+	void RemoveInactiveProjectiles(ProjectilePool& projectiles);
 
 	/**
 	 * @brief Spawns a new projectile with the given properties.
 	 *
-	 * Creates a new projectile and adds it to the provided projectiles vector.
+	 * Takes a free slot from the provided pool; no memory is allocated. The shot is dropped if the pool is full.
 	 *
-	 * @param projectiles The vector of unique pointers to projectile objects.
-	 * @param projectileAssetFileName The file name of the projectile asset.
+	 * @param projectiles The pool the projectile is taken from.
 	 * @param startingPosition The position where the projectile will spawn.
 	 * @param direction The direction in which the projectile will move (default is upwards).
 	 */
-	inline void SpawnProjectile(std::vector<std::unique_ptr<Projectile>>& projectiles, const std::string& projectileAssetFileName, const Vector2f& startingPosition, const Vector2f direction = { 0.0f, -1.0f })
-	{
-		projectiles.emplace_back(std::make_unique<Projectile>(projectileAssetFileName, startingPosition, direction));
-	}
+	void SpawnProjectile(ProjectilePool& projectiles, const Vector2f& startingPosition, const Vector2f direction = { 0.0f, -1.0f });
 
 	    /**
      * @brief Attempts to shoot a projectile with a random cooldown.
      *
      * Rolls a random number and checks if the projectile should be shot based on the cooldown and random chance.
-     * If the projectile is shot, it is added to the projectiles vector and the cooldown is reset.
+     * If the projectile is shot, it is spawned from the projectile pool and the cooldown is reset.
      *
-     * @param projectiles The vector of unique pointers to projectile objects.
+     * @param projectiles The pool the projectile is taken from.
      * @param deltaTime Time elapsed since the last update (used to handle cooldown).
-     * @param projectileFile The file name for the projectile's texture.
      * @param spawnPos The position to spawn the projectile.
      * @param direction The direction in which the projectile will move.
      * @param shootCooldown The current cooldown time before shooting.
@@ -101,9 +98,8 @@ namespace GameplayUtility
      * @param resetCooldownTime The cooldown time to reset after shooting.
      * @param rng Random generator used for determining if the projectile should be shot.
      */
-	void TryShootWithRandomCooldown(std::vector<std::unique_ptr<Projectile>>& projectiles,
+	void TryShootWithRandomCooldown(ProjectilePool& projectiles,
 		float deltaTime,
-		const std::string& projectileFile,
 		const Vector2f& spawnPos,
 		const Vector2f& direction,
 		float& shootCooldown,
@@ -1,27 +1,44 @@
 #include "stdafx.h"
 #include "Helper.h"
+#include "Core/Managers/AssetPack.h"
+#include "Core/Managers/ResourceCache.h"
+#include "Core/Utility/Strings.h"
 
-void CoreHelper::LoadTextureAndSprite(sf::Texture& outTexture, sf::Sprite& outSprite, const std::string& fileName)
+void CoreHelper::LoadTextureAndSprite(std::shared_ptr<sf::Texture>& outTexture, sf::Sprite& outSprite, const std::string& fileName)
 {
-	// Attempt to load the texture from the specified file
-	if (!outTexture.loadFromFile(fileName))
+#ifdef MOO_HEADLESS
+	// Headless builds never create textures: only give the sprite the image's size so hitboxes match the game
+	const sf::Vector2u size = ResourceCache::Get().GetTextureSize(fileName);
+	outSprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y)));
+#else
+	// Fetch the texture from the cache (an atlas page for packed images), it is only read from disk the first time
+	const SpriteRegion region = ResourceCache::Get().GetSpriteRegion(fileName);
+	outTexture = region.texture;
+	if (outTexture == nullptr)
 	{
 		// Log an error if the texture loading fails
 		Log::Print("Texture failed to load! ", LogLevel::ERROR_);
 		return;
 	}
 
-	// Set the sprite's texture once it has successfully loaded
-	outSprite.setTexture(outTexture);
+	// Set the sprite's texture once it has successfully loaded, showing only the image's part of an atlas page
+	outSprite.setTexture(*outTexture);
+	outSprite.setTextureRect(region.rect);
+#endif
 }
 
 void CoreHelper::LoadMusic(sf::Music& outMusic, const std::string& fileName)
 {
-	// Attempt to load and play the music from the specified file
-	if (!outMusic.openFromFile(fileName))  // Replace with your music file
+	// Attempt to open the music, streamed from the asset pack when it is packed
+	if (!AssetPack::Get().OpenMusic(outMusic, fileName))
 	{
 		// Log an error if the music loading fails
 		Log::Print("Failed to load background music.", LogLevel::ERROR_);
 		return;
 	};
 }
+
+std::string CoreHelper::GetWaveBannerPath(int waveNumber)
+{
+	return WAVE_BANNER_PREFIX + std::to_string(waveNumber) + ".png";
+}
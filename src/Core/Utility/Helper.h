@@ -5,13 +5,15 @@ namespace CoreHelper
 	/**
  * @brief Loads a texture and assigns it to a sprite.
  *
- * Loads a texture from a file and assigns it to the provided sprite. If the texture fails to load, an error message is logged.
+ * Fetches the texture from the ResourceCache and assigns it to the provided sprite. The file is only decoded the
+ * first time it is requested. Images packed in the texture atlas get the atlas page and their sub-rect. If the texture fails to load, an error message is logged.
+ * In headless builds (MOO_HEADLESS) no texture is created; the sprite only gets the image's size as its texture rect.
  *
- * @param texture The texture object to load the texture into.
+ * @param texture The shared texture handle that keeps the texture alive for the sprite.
  * @param sprite The sprite object to assign the texture to.
  * @param fileName The file name of the texture to load.
  */
-	void LoadTextureAndSprite(sf::Texture& outTexture, sf::Sprite& outSprite, const std::string& fileName);
+	void LoadTextureAndSprite(std::shared_ptr<sf::Texture>& outTexture, sf::Sprite& outSprite, const std::string& fileName);
 
 	/**
  * @brief Loads background music from a file.
@@ -23,5 +25,11 @@ namespace CoreHelper
  */
 	void LoadMusic(sf::Music& outMusic, const std::string& fileName);
 
-
+	/**
+ * @brief Builds the path of a wave banner image.
+ *
+ * @param waveNumber The wave number, from 1 to WAVE_BANNER_COUNT.
+ * @return The path of wave_<waveNumber>.png.
+ */
+	std::string GetWaveBannerPath(int waveNumber);
 }
\ No newline at end of file
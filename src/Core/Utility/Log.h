@@ -41,10 +41,9 @@ public:
 	 * @param text The message to display.
 	 * @param level The severity level (default is LogLevel::INFO).
 	 */
-	static void Print(const std::string& text, LogLevel level = LogLevel::INFO)
+	static void Print(std::string_view text, LogLevel level = LogLevel::INFO)
 	{
-		std::string logMessage = GetLogLevel(level) + " " + text;
-		std::cout << logMessage << std::endl;
+		std::cout << GetLogLevel(level) << ' ' << text << std::endl;
 	}
 
 	/**
@@ -58,10 +57,9 @@ public:
 	 * @param level The severity level (default is LogLevel::INFO).
 	 */
 	template <typename T>
-	static void Print(const std::string& text, T variable, LogLevel level = LogLevel::INFO)
+	static void Print(std::string_view text, T variable, LogLevel level = LogLevel::INFO)
 	{
-		std::string logMessage = GetLogLevel(level) + " " + text + ": ";
-		std::cout << logMessage << variable << std::endl;
+		std::cout << GetLogLevel(level) << ' ' << text << ": " << variable << std::endl;
 	}
 
 	/**
@@ -75,10 +73,9 @@ public:
 	 * @param level The severity level (default is LogLevel::INFO).
 	 */
 	template <typename T>
-	static void PrintMemory(const std::string& text, const T& variable, LogLevel level = LogLevel::INFO)
+	static void PrintMemory(std::string_view text, const T& variable, LogLevel level = LogLevel::INFO)
 	{
-		std::string logMessage = GetLogLevel(level) + " " + text + ": ";
-		std::cout << logMessage << static_cast<const void*>(&variable) << std::endl;
+		std::cout << GetLogLevel(level) << ' ' << text << ": " << static_cast<const void*>(&variable) << std::endl;
 	}
 
 private:
@@ -86,9 +83,9 @@ private:
 	 * @brief Returns the string representation of a log level.
 	 *
 	 * @param level The LogLevel to convert.
-	 * @return A string tag like "[INFO]", "[WARNING]", or "[ERROR]".
+	 * @return A string tag like "[INFO]", "[WARNING]", or "[ERROR]", streamed as is rather than copied.
 	 */
-	static std::string GetLogLevel(LogLevel level)
+	static const char* GetLogLevel(LogLevel level)
 	{
 		switch (level)
 		{
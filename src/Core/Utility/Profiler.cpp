@@ -0,0 +1,133 @@
+#include "stdafx.h"
+#include "Profiler.h"
+
+namespace
+{
+	/**
+	 * @brief Writes a string as a JSON string literal, escaping quotes and backslashes.
+	 */
+	void WriteJsonString(std::ostream& stream, const char* text)
+	{
+		stream << '"';
+		for (const char* c = text; *c != '\0'; ++c)
+		{
+			if (*c == '"' || *c == '\\')
+			{
+				stream << '\\';
+			}
+			stream << *c;
+		}
+		stream << '"';
+	}
+}
+
+ProfileRingBuffer::ProfileRingBuffer(uint32_t threadId)
+	: m_ThreadId(threadId)
+	, m_ThreadName(nullptr)
+	, m_WriteIndex(0)
+	, m_Slots(std::make_unique<Slot[]>(CAPACITY))
+{
+}
+
+void ProfileRingBuffer::Snapshot(std::vector<ProfileEvent>& outEvents) const
+{
+	// The writer may already be filling slot 'end', which is also the slot of event end - CAPACITY: skip that one
+	const uint64_t end = m_WriteIndex.load(std::memory_order_acquire);
+	const uint64_t begin = (end + 1 > CAPACITY) ? end + 1 - CAPACITY : 0;
+
+	for (uint64_t i = begin; i < end; ++i)
+	{
+		const Slot& slot = m_Slots[i & (CAPACITY - 1)];
+		if (slot.sequence.load(std::memory_order_acquire) != i + 1)
+		{
+			continue;
+		}
+
+		ProfileEvent event;
+		event.name = slot.name.load(std::memory_order_relaxed);
+		event.start = slot.start.load(std::memory_order_relaxed);
+		event.duration = slot.duration.load(std::memory_order_relaxed);
+
+		// Kept only if the writer did not start on the slot again during the copy
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (slot.sequence.load(std::memory_order_relaxed) == i + 1)
+		{
+			outEvents.push_back(event);
+		}
+	}
+}
+
+Profiler::Profiler()
+	: m_Epoch(std::chrono::steady_clock::now())
+	, m_IsEnabled(true)
+{
+}
+
+int64_t Profiler::Now() const
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_Epoch).count();
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+	GetThreadBuffer().SetThreadName(name);
+}
+
+bool Profiler::WriteChromeTrace(const std::string& fileName) const
+{
+	std::ofstream file(fileName);
+	if (!file.is_open())
+	{
+		Log::Print("Failed to open trace file", fileName, LogLevel::ERROR_);
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(m_BuffersMutex);
+
+	file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	bool isFirst = true;
+	std::size_t eventCount = 0;
+	std::vector<ProfileEvent> events;
+	for (const std::unique_ptr<ProfileRingBuffer>& buffer : m_Buffers)
+	{
+		// Thread names are metadata events
+		const char* threadName = buffer->GetThreadName();
+		if (threadName != nullptr)
+		{
+			file << (isFirst ? "\n" : ",\n") << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":" << buffer->GetThreadId() << ",\"args\":{\"name\":";
+			WriteJsonString(file, threadName);
+			file << "}}";
+			isFirst = false;
+		}
+
+		events.clear();
+		buffer->Snapshot(events);
+		for (const ProfileEvent& event : events)
+		{
+			file << (isFirst ? "\n" : ",\n") << "{\"ph\":\"X\",\"cat\":\"moo\",\"name\":";
+			WriteJsonString(file, event.name);
+			file << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << ",\"pid\":0,\"tid\":" << buffer->GetThreadId() << "}";
+			isFirst = false;
+		}
+
+		eventCount += events.size();
+	}
+	file << "\n]}\n";
+
+	Log::Print("Profiler events written to " + fileName, eventCount);
+	return true;
+}
+
+ProfileRingBuffer& Profiler::GetThreadBuffer()
+{
+	// Cached per thread, so only the first event of every thread takes the lock
+	thread_local ProfileRingBuffer* buffer = nullptr;
+	if (buffer == nullptr)
+	{
+		std::lock_guard<std::mutex> lock(m_BuffersMutex);
+		m_Buffers.push_back(std::make_unique<ProfileRingBuffer>(static_cast<uint32_t>(m_Buffers.size() + 1)));
+		buffer = m_Buffers.back().get();
+	}
+
+	return *buffer;
+}
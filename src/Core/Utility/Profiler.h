@@ -0,0 +1,268 @@
+/*!
+ * \file Profiler.h
+ *
+ * \brief Contains the Profiler singleton, the ProfileScope guard and the MOO_PROFILE_* macros used to time code.
+ *
+ * Put MOO_PROFILE_SCOPE("Name") or MOO_PROFILE_FUNCTION() at the top of a block and the time spent in it is recorded
+ * as one event. Every thread writes into its own fixed-size ring buffer, so recording never takes a lock nor allocates;
+ * when a buffer is full the oldest events are overwritten. WriteChromeTrace() dumps what is left as Chrome trace_event
+ * JSON, which can be opened in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * The macros only do something when MOO_PROFILE is defined; otherwise they expand to nothing and cost nothing.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+
+/**
+ * @struct ProfileEvent
+ * @brief One timed scope.
+ */
+struct ProfileEvent
+{
+	const char* name = nullptr; ///< Name of the scope, must outlive the profiler (string literal or __FUNCTION__)
+	int64_t start = 0;          ///< Start time, in microseconds since the profiler was created
+	int64_t duration = 0;       ///< Duration, in microseconds
+};
+
+/**
+ * @class ProfileRingBuffer
+ * @brief The events of one thread, written only by that thread.
+ *
+ * Every slot carries a sequence number: the owning thread marks the slot as being written, fills it, then stamps it
+ * with the event's index + 1 and bumps the write index. A reader on another thread copies a slot between two reads of
+ * its sequence and keeps it only if both match the index it expected, so it never keeps an event the writer was
+ * filling or had lapped meanwhile. The slot fields are atomics, which makes the concurrent copy well defined.
+ */
+class ProfileRingBuffer
+{
+public:
+	static constexpr std::size_t CAPACITY = 1 << 16; ///< Events kept per thread, must be a power of two
+
+	/**
+	 * @brief Constructs an empty buffer.
+	 *
+	 * @param threadId The id the thread is shown with in the trace.
+	 */
+	explicit ProfileRingBuffer(uint32_t threadId);
+
+	/**
+	 * @brief Appends an event, overwriting the oldest one when full. Only the owning thread may call this.
+	 *
+	 * @param event The event to append.
+	 */
+	inline void Push(const ProfileEvent& event)
+	{
+		const uint64_t index = m_WriteIndex.load(std::memory_order_relaxed);
+		Slot& slot = m_Slots[index & (CAPACITY - 1)];
+
+		// Readers see the slot as invalid from here until the final stamp
+		slot.sequence.store(WRITING, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		slot.name.store(event.name, std::memory_order_relaxed);
+		slot.start.store(event.start, std::memory_order_relaxed);
+		slot.duration.store(event.duration, std::memory_order_relaxed);
+		slot.sequence.store(index + 1, std::memory_order_release);
+
+		m_WriteIndex.store(index + 1, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Copies the events still in the buffer, oldest first. Safe to call from any thread.
+	 *
+	 * @param outEvents Receives the events, appended at the end.
+	 */
+	void Snapshot(std::vector<ProfileEvent>& outEvents) const;
+
+	// Getters
+
+	/**
+	 * @brief Gets the id the thread is shown with in the trace.
+	 *
+	 * @return The thread id.
+	 */
+	inline uint32_t GetThreadId() const { return m_ThreadId; }
+
+	/**
+	 * @brief Gets the name of the thread, set with Profiler::SetThreadName().
+	 *
+	 * @return The thread name, or nullptr if it was never named.
+	 */
+	inline const char* GetThreadName() const { return m_ThreadName.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief Sets the name of the thread.
+	 *
+	 * @param name The name, must outlive the profiler.
+	 */
+	inline void SetThreadName(const char* name) { m_ThreadName.store(name, std::memory_order_release); }
+
+private:
+	static constexpr uint64_t WRITING = ~uint64_t(0); ///< Sequence of a slot the owner is filling
+
+	/**
+	 * @struct Slot
+	 * @brief One event of the ring and the sequence number validating it.
+	 */
+	struct Slot
+	{
+		std::atomic<uint64_t> sequence{ 0 };       ///< Index + 1 of the event held, 0 if none, WRITING while filled
+		std::atomic<const char*> name{ nullptr };  ///< See ProfileEvent::name
+		std::atomic<int64_t> start{ 0 };           ///< See ProfileEvent::start
+		std::atomic<int64_t> duration{ 0 };        ///< See ProfileEvent::duration
+	};
+
+	uint32_t m_ThreadId;                       ///< The id the thread is shown with in the trace
+	std::atomic<const char*> m_ThreadName;     ///< The name the thread is shown with in the trace
+	std::atomic<uint64_t> m_WriteIndex;        ///< Number of events ever pushed
+	std::unique_ptr<Slot[]> m_Slots;           ///< The ring of events
+};
+
+/**
+ * @class Profiler
+ * @brief Singleton collecting the ring buffers of every thread and writing them out as a Chrome trace.
+ *
+ * A thread gets its buffer the first time it records; that registration is the only time the profiler locks.
+ * Recording can be paused at runtime with SetEnabled(), which leaves the events already recorded in place.
+ */
+class Profiler
+{
+public:
+	/**
+	 * @brief Retrieves the singleton instance of the Profiler.
+	 *
+	 * @return Reference to the global Profiler instance.
+	 */
+	static Profiler& Get()
+	{
+		static Profiler instance;
+		return instance;
+	}
+
+	/**
+	 * @brief Gets the current time on the profiler's clock.
+	 *
+	 * @return Microseconds since the profiler was created.
+	 */
+	int64_t Now() const;
+
+	/**
+	 * @brief Records a finished scope on the calling thread's buffer.
+	 *
+	 * @param name Name of the scope, must outlive the profiler.
+	 * @param start Start time, from Now().
+	 * @param end End time, from Now().
+	 */
+	inline void Record(const char* name, int64_t start, int64_t end)
+	{
+		GetThreadBuffer().Push({ name, start, end - start });
+	}
+
+	/**
+	 * @brief Names the calling thread in the trace.
+	 *
+	 * @param name The name, must outlive the profiler.
+	 */
+	void SetThreadName(const char* name);
+
+	/**
+	 * @brief Pauses or resumes recording on every thread.
+	 *
+	 * @param isEnabled True to record.
+	 */
+	inline void SetEnabled(bool isEnabled) { m_IsEnabled.store(isEnabled, std::memory_order_relaxed); }
+
+	/**
+	 * @brief Checks whether scopes are being recorded.
+	 *
+	 * @return True if recording.
+	 */
+	inline bool IsEnabled() const { return m_IsEnabled.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Writes the events of every thread as Chrome trace_event JSON.
+	 *
+	 * Can be called while other threads keep recording; their newest events may be missing from the file.
+	 *
+	 * @param fileName The path of the JSON file to write.
+	 * @return True if the file was written.
+	 */
+	bool WriteChromeTrace(const std::string& fileName) const;
+
+private:
+	/**
+	 * @brief Private constructor to enforce singleton pattern.
+	 */
+	Profiler();
+
+	// Deleted copy constructor and assignment operator
+	Profiler(const Profiler&) = delete;
+	Profiler& operator=(const Profiler&) = delete;
+
+	/**
+	 * @brief Gets the ring buffer of the calling thread, creating it on the thread's first event.
+	 *
+	 * @return The calling thread's buffer.
+	 */
+	ProfileRingBuffer& GetThreadBuffer();
+
+private:
+	std::chrono::steady_clock::time_point m_Epoch;              ///< Time zero of every event
+	std::atomic<bool> m_IsEnabled;                              ///< Whether scopes are recorded
+	mutable std::mutex m_BuffersMutex;                          ///< Guards m_Buffers, taken once per thread and by the dump
+	std::vector<std::unique_ptr<ProfileRingBuffer>> m_Buffers;  ///< One buffer per thread that ever recorded
+};
+
+/**
+ * @class ProfileScope
+ * @brief Records the time between its construction and destruction. Use it through MOO_PROFILE_SCOPE.
+ */
+class ProfileScope
+{
+public:
+	/**
+	 * @brief Starts timing, unless the profiler is paused.
+	 *
+	 * @param name Name of the scope, must outlive the profiler.
+	 */
+	explicit ProfileScope(const char* name)
+		: m_Name(name)
+		, m_Start(Profiler::Get().IsEnabled() ? Profiler::Get().Now() : -1)
+	{
+	}
+
+	/**
+	 * @brief Records the scope.
+	 */
+	~ProfileScope()
+	{
+		if (m_Start >= 0)
+		{
+			Profiler::Get().Record(m_Name, m_Start, Profiler::Get().Now());
+		}
+	}
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+	const char* m_Name; ///< Name of the scope
+	int64_t m_Start;    ///< Start time, -1 if the profiler was paused
+};
+
+#define MOO_PROFILE_CONCAT_INNER(a, b) a##b
+#define MOO_PROFILE_CONCAT(a, b) MOO_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef MOO_PROFILE
+#define MOO_PROFILE_SCOPE(name) ProfileScope MOO_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define MOO_PROFILE_FUNCTION() MOO_PROFILE_SCOPE(__FUNCTION__)
+#define MOO_PROFILE_THREAD(name) Profiler::Get().SetThreadName(name)
+#define MOO_PROFILE_DUMP(fileName) Profiler::Get().WriteChromeTrace(fileName)
+#else
+#define MOO_PROFILE_SCOPE(name) ((void)0)
+#define MOO_PROFILE_FUNCTION() ((void)0)
+#define MOO_PROFILE_THREAD(name) ((void)0)
+#define MOO_PROFILE_DUMP(fileName) ((void)0)
+#endif
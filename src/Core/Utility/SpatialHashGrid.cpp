@@ -0,0 +1,95 @@
+#include "stdafx.h"
+#include "SpatialHashGrid.h"
+#include "Core/Memory/FrameArena.h"
+
+SpatialHashGrid::SpatialHashGrid(float cellSize /*= 64.0f*/, std::size_t bucketCount /*= 4096*/)
+	: m_InverseCellSize(1.0f / cellSize)
+	, m_ChunkEntries(1)
+	, m_UsedChunks(1)
+	, m_Memory(MemoryTag::ENTITIES)
+{
+	// Round the bucket count up to a power of two so hashing is a mask instead of a modulo
+	std::size_t buckets = 1;
+	while (buckets < bucketCount)
+	{
+		buckets <<= 1;
+	}
+
+	m_BucketMask = static_cast<std::uint32_t>(buckets - 1);
+	m_BucketStart.assign(buckets + 1, 0);
+}
+
+void SpatialHashGrid::Clear()
+{
+	for (std::vector<Entry>& entries : m_ChunkEntries)
+	{
+		entries.clear();
+	}
+	m_UsedChunks = 1;
+	m_Items.clear();
+	std::fill(m_BucketStart.begin(), m_BucketStart.end(), 0);
+}
+
+void SpatialHashGrid::Insert(std::uint32_t id, const sf::FloatRect& bounds)
+{
+	AddEntries(m_ChunkEntries[0], id, bounds);
+}
+
+void SpatialHashGrid::AddEntries(std::vector<Entry>& entries, std::uint32_t id, const sf::FloatRect& bounds) const
+{
+	const int minX = ToCell(bounds.left);
+	const int minY = ToCell(bounds.top);
+	const int maxX = ToCell(bounds.left + bounds.width);
+	const int maxY = ToCell(bounds.top + bounds.height);
+
+	// Register the object in every cell its box touches
+	for (int cellY = minY; cellY <= maxY; ++cellY)
+	{
+		for (int cellX = minX; cellX <= maxX; ++cellX)
+		{
+			entries.push_back({ id, HashCell(cellX, cellY), bounds });
+		}
+	}
+}
+
+void SpatialHashGrid::Build()
+{
+	// Count the entries of every bucket, shifted by one so the prefix sum gives start offsets
+	std::fill(m_BucketStart.begin(), m_BucketStart.end(), 0);
+	std::size_t entryCount = 0;
+	for (std::size_t chunk = 0; chunk < m_UsedChunks; ++chunk)
+	{
+		for (const Entry& entry : m_ChunkEntries[chunk])
+		{
+			++m_BucketStart[entry.bucket + 1];
+		}
+		entryCount += m_ChunkEntries[chunk].size();
+	}
+
+	for (std::size_t i = 1; i < m_BucketStart.size(); ++i)
+	{
+		m_BucketStart[i] += m_BucketStart[i - 1];
+	}
+
+	// Scatter the entries into their buckets, through write cursors that only live for this build
+	const std::size_t bucketCount = m_BucketStart.size() - 1;
+	std::uint32_t* bucketCursor = FrameArena::Get().AllocateArray<std::uint32_t>(bucketCount);
+	std::copy(m_BucketStart.begin(), m_BucketStart.end() - 1, bucketCursor);
+	m_Items.resize(entryCount);
+	for (std::size_t chunk = 0; chunk < m_UsedChunks; ++chunk)
+	{
+		for (const Entry& entry : m_ChunkEntries[chunk])
+		{
+			m_Items[bucketCursor[entry.bucket]++] = entry;
+		}
+	}
+
+	// Only reaches the tracker when one of the arrays grew
+	std::size_t bytes = m_Items.capacity() * sizeof(Entry)
+		+ m_BucketStart.capacity() * sizeof(std::uint32_t);
+	for (const std::vector<Entry>& entries : m_ChunkEntries)
+	{
+		bytes += entries.capacity() * sizeof(Entry);
+	}
+	m_Memory.Resize(bytes);
+}
@@ -0,0 +1,198 @@
+/*!
+ * \file SpatialHashGrid.h
+ *
+ * \brief Contains the SpatialHashGrid class, a uniform-grid broadphase for collision queries.
+ *
+ * Objects are inserted with their axis-aligned bounding box into every grid cell they overlap. Cells are hashed
+ * into a fixed number of buckets, so the grid covers an unbounded world without allocating per cell. After Build()
+ * the entries are sorted by bucket (counting sort) into one flat array, which keeps queries cache friendly.
+ * Rebuild() computes the entries of a whole container as jobs on the JobSystem, one list per chunk of objects.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Memory/MemoryTracker.h"
+
+/**
+ * @class SpatialHashGrid
+ * @brief Hashes AABBs into uniform cells and answers "what could overlap this box" queries.
+ *
+ * Typical usage per tick:
+ * - Clear()
+ * - Insert() every object
+ * - Build()
+ * - Query() as many times as needed
+ *
+ * or Rebuild() in place of the first three steps, which does the same work in parallel.
+ *
+ * All internal buffers keep their capacity between ticks, so rebuilding the grid every frame does not allocate
+ * once the buffers have grown to the working set. Queries can report false positives (hash collisions or objects
+ * spanning several queried cells), so callers must still run the precise intersection test.
+ */
+class SpatialHashGrid
+{
+public:
+	/**
+	 * @brief Constructs the grid.
+	 *
+	 * @param cellSize The width and height of one grid cell, ideally a bit larger than a typical object.
+	 * @param bucketCount The number of hash buckets; rounded up to a power of two.
+	 */
+	explicit SpatialHashGrid(float cellSize = 64.0f, std::size_t bucketCount = 4096);
+
+	/**
+	 * @brief Removes every inserted object, keeping the allocated buffers.
+	 */
+	void Clear();
+
+	/**
+	 * @brief Inserts an object into every cell its bounding box overlaps.
+	 *
+	 * @param id The caller's identifier for the object (typically its index in a container).
+	 * @param bounds The world-space bounding box of the object.
+	 */
+	void Insert(std::uint32_t id, const sf::FloatRect& bounds);
+
+	/**
+	 * @brief Sorts the inserted objects by bucket. Must be called after the last Insert() and before Query().
+	 *
+	 * The per-bucket write cursors of the sort are scratch from the FrameArena, so call it during a frame.
+	 */
+	void Build();
+
+	/**
+	 * @brief Clears the grid, inserts every object of a container in parallel and builds the grid.
+	 *
+	 * Each job computes the cells of one chunk of objects into its own entry list; the lists are sorted in chunk
+	 * order, so the grid comes out identical whatever thread ran which chunk.
+	 *
+	 * @tparam BoundsFunction Callable with the signature bool(std::size_t index, sf::FloatRect& outBounds), returning
+	 * false for objects to leave out. Called concurrently.
+	 * @param count The number of objects in the container; their ids are their indices.
+	 * @param getBounds Gives the bounds of an object.
+	 */
+	template <typename BoundsFunction>
+	void Rebuild(std::size_t count, BoundsFunction&& getBounds)
+	{
+		Clear();
+
+		const std::size_t chunkCount = std::max<std::size_t>((count + JOB_GRAIN_SIZE - 1) / JOB_GRAIN_SIZE, 1);
+		if (m_ChunkEntries.size() < chunkCount)
+		{
+			m_ChunkEntries.resize(chunkCount);
+		}
+		m_UsedChunks = chunkCount;
+
+		// A job may be handed more than one chunk (when there are no workers), so it splits its range again
+		JobSystem::Get().ParallelFor(count, JOB_GRAIN_SIZE, [&](std::size_t begin, std::size_t end)
+			{
+				sf::FloatRect bounds;
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					if (getBounds(i, bounds))
+					{
+						AddEntries(m_ChunkEntries[i / JOB_GRAIN_SIZE], static_cast<std::uint32_t>(i), bounds);
+					}
+				}
+			});
+
+		Build();
+	}
+
+	/**
+	 * @brief Visits every object stored in the cells overlapped by a bounding box.
+	 *
+	 * The callback receives the object's id and the bounds it was inserted with, and returns true to stop the query.
+	 *
+	 * @tparam Callback Callable with the signature bool(std::uint32_t id, const sf::FloatRect& bounds).
+	 * @param bounds The world-space bounding box to query.
+	 * @param callback The function called for each candidate.
+	 */
+	template <typename Callback>
+	void Query(const sf::FloatRect& bounds, Callback&& callback) const
+	{
+		const int minX = ToCell(bounds.left);
+		const int minY = ToCell(bounds.top);
+		const int maxX = ToCell(bounds.left + bounds.width);
+		const int maxY = ToCell(bounds.top + bounds.height);
+
+		for (int cellY = minY; cellY <= maxY; ++cellY)
+		{
+			for (int cellX = minX; cellX <= maxX; ++cellX)
+			{
+				const std::uint32_t bucket = HashCell(cellX, cellY);
+				for (std::uint32_t i = m_BucketStart[bucket]; i < m_BucketStart[bucket + 1]; ++i)
+				{
+					if (callback(m_Items[i].id, m_Items[i].bounds))
+					{
+						return;
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief Gets the number of cell entries stored in the grid.
+	 *
+	 * @return The number of (object, cell) pairs sorted by the last Build().
+	 */
+	inline std::size_t GetEntryCount() const { return m_Items.size(); }
+
+private:
+	static constexpr std::size_t JOB_GRAIN_SIZE = 1024; ///< Objects inserted per job by Rebuild()
+
+	/**
+	 * @struct Entry
+	 * @brief One object registered in one cell.
+	 */
+	struct Entry
+	{
+		std::uint32_t id;      ///< The caller's identifier for the object
+		std::uint32_t bucket;  ///< The hash bucket of the cell the entry belongs to
+		sf::FloatRect bounds;  ///< The bounds the object was inserted with
+	};
+
+	/**
+	 * @brief Appends an entry for every cell a bounding box overlaps.
+	 *
+	 * @param entries The list receiving the entries.
+	 * @param id The caller's identifier for the object.
+	 * @param bounds The world-space bounding box of the object.
+	 */
+	void AddEntries(std::vector<Entry>& entries, std::uint32_t id, const sf::FloatRect& bounds) const;
+
+	/**
+	 * @brief Converts a world coordinate to a cell coordinate.
+	 *
+	 * @param value The world-space coordinate.
+	 * @return The index of the cell containing the coordinate.
+	 */
+	inline int ToCell(float value) const { return static_cast<int>(std::floor(value * m_InverseCellSize)); }
+
+	/**
+	 * @brief Hashes a cell coordinate into a bucket index.
+	 *
+	 * @param cellX The horizontal cell index.
+	 * @param cellY The vertical cell index.
+	 * @return The bucket the cell maps to.
+	 */
+	inline std::uint32_t HashCell(int cellX, int cellY) const
+	{
+		const std::uint32_t hash = (static_cast<std::uint32_t>(cellX) * 73856093u) ^ (static_cast<std::uint32_t>(cellY) * 19349663u);
+		return hash & m_BucketMask;
+	}
+
+private:
+	float m_InverseCellSize;    ///< 1 / cell size, so cell lookups multiply instead of divide
+	std::uint32_t m_BucketMask; ///< bucketCount - 1, bucketCount being a power of two
+
+	std::vector<std::vector<Entry>> m_ChunkEntries; ///< Entries waiting for Build(), one list per chunk of Rebuild() (Insert() uses the first)
+	std::size_t m_UsedChunks;                  ///< Number of lists in m_ChunkEntries filled since the last Clear()
+	std::vector<Entry> m_Items;                ///< Entries sorted by bucket
+	std::vector<std::uint32_t> m_BucketStart;  ///< Start offset of each bucket in m_Items (bucketCount + 1 values)
+	TrackedMemory m_Memory;                    ///< Storage of the grid, reported as entities
+};
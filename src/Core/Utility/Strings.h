@@ -2,6 +2,9 @@
 
 constexpr const char* RESOURCE_PATH = "../resources/";
 
+// ASSET PACK (built from resources/ by the PackBuilder tool, see AssetPack)
+constexpr const char* ASSET_PACK = "resources.moopack";
+
 
 // Spaceship
 constexpr const char* SPACESHIP = "resources/textures/spaceship/space_ship.png";
@@ -13,6 +16,7 @@ constexpr const char* PIG = "resources/textures/enemies/pig.png";
 // Projectiles
 constexpr const char* BOMB = "resources/textures/projectiles/Bomb.png";
 constexpr const char* EGG = "resources/textures/projectiles/egg.png";
+constexpr const char* COW_PROJECTILE = "resources/textures/projectiles/cow_projectile.png";
 
 // Backgrounds
 constexpr const char* GAME_BACKGROUND = "resources/textures/ui/background/background.png";
@@ -35,3 +39,17 @@ constexpr const char* FONT_C = "resources/fonts/OpenSans-Light.ttf";
 // UI ELEMENTS
 constexpr const char* CURSOR = "resources/textures/ui/cursors/cursor.png";
 constexpr const char* BUTTONS_SPRITESHEET = "resources/textures/mainmenu/MainMenuButton/buttons_spritesheet.png";
+
+// HEALTH
+constexpr const char* HEALTH_BOTTLE_FULL = "resources/textures/ui/health/HealthBottle/FullHealth.png";
+constexpr const char* HEALTH_BOTTLE_1 = "resources/textures/ui/health/HealthBottle/Health1.png";
+constexpr const char* HEALTH_BOTTLE_2 = "resources/textures/ui/health/HealthBottle/Health2.png";
+constexpr const char* HEALTH_BOTTLE_3 = "resources/textures/ui/health/HealthBottle/Health3.png";
+constexpr const char* HEALTH_BOTTLE_4 = "resources/textures/ui/health/HealthBottle/Health4.png";
+
+// WAVES (wave_1.png to wave_100.png, see CoreHelper::GetWaveBannerPath)
+constexpr const char* WAVE_BANNER_PREFIX = "resources/textures/ui/wavetemplate/WaveNumber/moowars_wave_numbers/wave_";
+constexpr int WAVE_BANNER_COUNT = 100;
+
+// WAVE DEFINITIONS (see WaveLoader)
+constexpr const char* LEVEL_ONE_WAVES = "resources/waves/level_one.waves";
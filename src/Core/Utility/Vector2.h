@@ -150,6 +150,22 @@ public:
         return (this->x * other.y) - (this->y * other.x);
     }
 
+    /**
+     * @brief Linearly interpolate towards another vector.
+     *
+     * Returns this vector for an alpha of 0 and the target for an alpha of 1. Used to draw positions between two
+     * simulation ticks.
+     *
+     * @param target The vector to interpolate towards.
+     * @param alpha The interpolation factor, usually in [0, 1].
+     * @return The interpolated vector.
+     */
+    Vector2 Lerp(const Vector2& target, float alpha) const
+    {
+        return Vector2(static_cast<T>(this->x + (target.x - this->x) * alpha),
+            static_cast<T>(this->y + (target.y - this->y) * alpha));
+    }
+
     /**
      * @brief Add another vector to this vector.
      *
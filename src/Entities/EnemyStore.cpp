@@ -0,0 +1,340 @@
+#include "stdafx.h"
+#include "EnemyStore.h"
+#include "Core/Utility/Strings.h"
+#include "Core/Managers/SoundManager.h"
+#include "Core/Managers/GameEventQueue.h"
+#include "Core/Utility/Helper.h"
+#include "Core/Rendering/SpriteBatch.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Memory/FrameArena.h"
+
+// ********************* ENEMY SOUND CONSTANTS ********************
+constexpr int DEATH_SOUND_INSTANCES = 6;        // Kills landing together overlap up to this many deaths
+constexpr int DEATH_SOUND_PRIORITY = 1;         // Cuts shots, never the spaceship hit
+// ****************************************************
+
+// ********************* ENEMY UPDATE CONSTANTS ********************
+constexpr std::size_t ENEMY_JOB_GRAIN_SIZE = 1024; // Enemies moved per job; smaller waves run on the calling thread
+constexpr float MOVEMENT_LIMIT = 200.0f;           // Height beyond which enemies turn back up
+// ****************************************************
+
+// ********************* ENEMY SHOOTING CONSTANTS ********************
+constexpr std::uint32_t SPAWN_COOLDOWN_DRAW = 0;   // Draw index of the first shot delay, taken at spawn
+constexpr std::uint32_t SHOT_ROLL_DRAW = 1;        // Draw index of the shot roll, taken every tick
+// ****************************************************
+
+// Sprite of each EnemyType, both packed in the gameplay atlas so mixed waves still batch into one draw call
+const std::array<const char*, ENEMY_TYPE_COUNT> ENEMY_TYPE_FILES = { PIG, COW };
+
+EnemyStore::EnemyStore(const std::string& projectileFile, std::size_t projectileCapacity /*= 4096*/)
+	: m_Memory(MemoryTag::ENTITIES)
+	, m_Projectiles(projectileFile, projectileCapacity)
+	, m_RNG(static_cast<std::uint64_t>(std::time(0)))
+	, m_NextEntityId(0)
+	, m_Tick(0)
+	, m_MaxShotRoll(1)
+{
+	for (std::size_t type = 0; type < ENEMY_TYPE_COUNT; ++type)
+	{
+		TypeVisual& visual = m_TypeVisuals[type];
+		sf::Sprite sprite;
+		CoreHelper::LoadTextureAndSprite(visual.texture, sprite, ENEMY_TYPE_FILES[type]);
+		visual.textureRect = sprite.getTextureRect();
+		visual.size = Vector2f(sprite.getGlobalBounds().width, sprite.getGlobalBounds().height);
+	}
+
+	// Load the sound into the SoundManager
+	SoundManager::Get().LoadSound(SoundID::COW_DEATH, COW_DEATH, DEATH_SOUND_INSTANCES, DEATH_SOUND_PRIORITY);
+}
+
+std::size_t EnemyStore::Spawn(const Vector2f& position, DifficultyLevel difficultyLevel, EnemyType type /*= EnemyType::PIG*/)
+{
+	const std::uint32_t entityId = m_NextEntityId++;
+
+	m_Positions.push_back(position);
+	m_PreviousPositions.push_back(position);
+	m_VerticalDirections.push_back(-1.0f);
+	m_TimeElapsed.push_back(0.0f);
+	m_ShootCooldowns.push_back(m_RNG.GetFloat(entityId, m_Tick, 0.0f, 1.0f, SPAWN_COOLDOWN_DRAW));
+	m_Difficulties.push_back(difficultyLevel);
+	m_Types.push_back(type);
+	m_IsAlive.push_back(1);
+	m_IsShooting.push_back(0);
+	m_EntityIds.push_back(entityId);
+	UpdateMemoryReport();
+	return m_Positions.size() - 1;
+}
+
+void EnemyStore::Reserve(std::size_t count)
+{
+	m_Positions.reserve(count);
+	m_PreviousPositions.reserve(count);
+	m_VerticalDirections.reserve(count);
+	m_TimeElapsed.reserve(count);
+	m_ShootCooldowns.reserve(count);
+	m_Difficulties.reserve(count);
+	m_Types.reserve(count);
+	m_IsAlive.reserve(count);
+	m_IsShooting.reserve(count);
+	m_EntityIds.reserve(count);
+	UpdateMemoryReport();
+}
+
+void EnemyStore::UpdateMemoryReport()
+{
+	// Every array grows with the same count, so one capacity stands for all of them
+	constexpr std::size_t BYTES_PER_ENEMY = 2 * sizeof(Vector2f) + 3 * sizeof(float) + sizeof(DifficultyLevel)
+		+ sizeof(EnemyType) + 2 * sizeof(std::uint8_t) + sizeof(std::uint32_t);
+	m_Memory.Resize(m_Positions.capacity() * BYTES_PER_ENEMY);
+}
+
+void EnemyStore::Seed(std::uint64_t seed)
+{
+	m_RNG.SetSeed(seed);
+	m_NextEntityId = 0;
+	m_Tick = 0;
+}
+
+void EnemyStore::Update(float deltaTime)
+{
+	JobSystem& jobSystem = JobSystem::Get();
+
+	++m_Tick;
+	UpdateShootingParameters(100, 10, 1.0f);
+
+	// Enemies and the projectiles already flying touch different arrays, so both are scheduled before waiting
+	auto moveEnemies = [this, deltaTime](std::size_t begin, std::size_t end)
+		{
+			UpdateRange(deltaTime, begin, end);
+		};
+	auto moveProjectiles = [this, deltaTime](std::size_t begin, std::size_t end)
+		{
+			m_Projectiles.UpdateRange(deltaTime, begin, end);
+		};
+
+	JobCounter enemiesMoved;
+	JobCounter projectilesMoved;
+	jobSystem.ParallelFor(m_Positions.size(), ENEMY_JOB_GRAIN_SIZE, moveEnemies, enemiesMoved);
+	jobSystem.ParallelFor(m_Projectiles.Size(), ProjectilePool::JOB_GRAIN_SIZE, moveProjectiles, projectilesMoved);
+
+	// Shooting reads the new positions and appends past the projectiles the jobs are moving
+	jobSystem.Wait(enemiesMoved);
+	ProcessShooting(deltaTime);
+
+	jobSystem.Wait(projectilesMoved);
+	m_Projectiles.RemoveInactive();
+}
+
+void EnemyStore::Draw(SpriteBatch& batch, float alpha /*= 1.0f*/) const
+{
+	for (std::size_t i = 0; i < m_Positions.size(); ++i)
+	{
+		const TypeVisual& visual = m_TypeVisuals[static_cast<std::size_t>(m_Types[i])];
+		if (m_IsAlive[i] && visual.texture != nullptr)
+		{
+			batch.Draw(*visual.texture, visual.textureRect, m_PreviousPositions[i].Lerp(m_Positions[i], alpha));
+		}
+	}
+
+	m_Projectiles.Draw(batch, alpha);
+}
+
+void EnemyStore::RemoveDead()
+{
+	std::size_t index = 0;
+	while (index < m_Positions.size())
+	{
+		if (m_IsAlive[index])
+		{
+			++index;
+			continue;
+		}
+
+		GameEventQueue::Get().Push(GameEventType::ENEMY_KILLED, m_Positions[index]);
+
+		// Do not advance, the enemy swapped in still has to be checked
+		SwapAndPop(index);
+	}
+}
+
+void EnemyStore::Clear()
+{
+	m_Positions.clear();
+	m_PreviousPositions.clear();
+	m_VerticalDirections.clear();
+	m_TimeElapsed.clear();
+	m_ShootCooldowns.clear();
+	m_Difficulties.clear();
+	m_Types.clear();
+	m_IsAlive.clear();
+	m_IsShooting.clear();
+	m_EntityIds.clear();
+	m_Projectiles.Clear();
+}
+
+void EnemyStore::UpdateRange(float deltaTime, std::size_t begin, std::size_t end)
+{
+	// Keep the last tick's positions so rendering can interpolate between ticks
+	std::copy(m_Positions.begin() + begin, m_Positions.begin() + end, m_PreviousPositions.begin() + begin);
+
+	OnMove(deltaTime, begin, end);
+	ReverseMovement(MOVEMENT_LIMIT, begin, end); // If the max limit is hit, reverse the direction
+	RollShots(deltaTime, begin, end);
+}
+
+void EnemyStore::OnMove(float deltaTime, std::size_t begin, std::size_t end, float verticalSpeed /*= 50.0f*/, float amplitude /*= 50.0f*/, float frequency /*= 2.0f*/)
+{
+	for (std::size_t i = begin; i < end; ++i)
+	{
+		m_TimeElapsed[i] += deltaTime;
+
+		// Sine sway horizontally, drift in the current direction vertically
+		m_Positions[i].x += amplitude * std::sin(frequency * m_TimeElapsed[i]) * deltaTime;
+		m_Positions[i].y += verticalSpeed * m_VerticalDirections[i] * deltaTime;
+	}
+}
+
+void EnemyStore::ReverseMovement(float movementLimit, std::size_t begin, std::size_t end)
+{
+	// Reverse direction if limits are hit
+	for (std::size_t i = begin; i < end; ++i)
+	{
+		const float y = m_Positions[i].y;
+		if (y > movementLimit)
+		{
+			m_VerticalDirections[i] = -1.f;
+		}
+		else if (y < 0)
+		{
+			m_VerticalDirections[i] = 1.f;
+		}
+	}
+}
+
+void EnemyStore::UpdateShootingParameters(int baseMaxChanceToHit, int baseRequiredRollToShoot, float baseCooldownDuration)
+{
+	// Adjust shooting parameters based on difficulty, once for every level
+	for (std::size_t level = 0; level < DIFFICULTY_LEVEL_COUNT; ++level)
+	{
+		int requiredRollToShoot = baseRequiredRollToShoot;
+		float cooldownDuration = baseCooldownDuration;
+
+		switch (static_cast<DifficultyLevel>(level))
+		{
+		case DifficultyLevel::VERY_EASY:
+			requiredRollToShoot += 20;
+			cooldownDuration += 1.0f;
+			break;
+
+		case DifficultyLevel::EASY:
+			requiredRollToShoot += 10;
+			cooldownDuration += 0.5f;
+			break;
+
+		case DifficultyLevel::NORMAL:
+			// default values
+			break;
+
+		case DifficultyLevel::HARD:
+			requiredRollToShoot -= 5;
+			cooldownDuration -= 0.2f;
+			break;
+
+		case DifficultyLevel::VERY_HARD:
+			requiredRollToShoot -= 10;
+			cooldownDuration -= 0.4f;
+			break;
+
+		case DifficultyLevel::INSANE:
+			requiredRollToShoot -= 15;
+			cooldownDuration -= 0.6f;
+			break;
+		}
+
+		m_ShootingParameters[level].requiredRollToShoot = std::clamp(requiredRollToShoot, 1, baseMaxChanceToHit);
+		m_ShootingParameters[level].cooldownDuration = std::max(0.1f, cooldownDuration);
+	}
+
+	m_MaxShotRoll = baseMaxChanceToHit;
+}
+
+void EnemyStore::RollShots(float deltaTime, std::size_t begin, std::size_t end)
+{
+	// Scratch of this job only, sized for the whole range so the rolls are drawn in a single batch
+	FrameArena& arena = FrameArena::Get();
+	const std::size_t rangeSize = end - begin;
+	std::size_t* shooters = arena.AllocateArray<std::size_t>(rangeSize);
+	std::uint32_t* shooterIds = arena.AllocateArray<std::uint32_t>(rangeSize);
+	int* rolls = arena.AllocateArray<int>(rangeSize);
+
+	// Gather the enemies whose cooldown ran out
+	std::size_t shooterCount = 0;
+	for (std::size_t index = begin; index < end; ++index)
+	{
+		m_IsShooting[index] = 0;
+		m_ShootCooldowns[index] -= deltaTime;
+		if (m_ShootCooldowns[index] <= 0.f && m_IsAlive[index])
+		{
+			shooters[shooterCount] = index;
+			shooterIds[shooterCount] = m_EntityIds[index];
+			++shooterCount;
+		}
+	}
+
+	m_RNG.GenerateInts(shooterIds, shooterCount, m_Tick, SHOT_ROLL_DRAW, 1, m_MaxShotRoll, rolls);
+
+	for (std::size_t s = 0; s < shooterCount; ++s)
+	{
+		const std::size_t i = shooters[s];
+		const ShootingParameters& shooting = m_ShootingParameters[static_cast<std::size_t>(m_Difficulties[i])];
+		if (rolls[s] <= shooting.requiredRollToShoot)
+		{
+			m_ShootCooldowns[i] = shooting.cooldownDuration;
+			m_IsShooting[i] = 1;
+		}
+	}
+}
+
+void EnemyStore::ProcessShooting(float deltaTime)
+{
+	const std::size_t count = m_Positions.size();
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		if (!m_IsShooting[i])
+		{
+			continue;
+		}
+
+		if (Projectile* projectile = m_Projectiles.Spawn(m_Positions[i], Vector2f(0.0f, 1.0f)))
+		{
+			projectile->Update(deltaTime);
+		}
+	}
+}
+
+void EnemyStore::SwapAndPop(std::size_t index)
+{
+	const std::size_t last = m_Positions.size() - 1;
+
+	m_Positions[index] = m_Positions[last];
+	m_PreviousPositions[index] = m_PreviousPositions[last];
+	m_VerticalDirections[index] = m_VerticalDirections[last];
+	m_TimeElapsed[index] = m_TimeElapsed[last];
+	m_ShootCooldowns[index] = m_ShootCooldowns[last];
+	m_Difficulties[index] = m_Difficulties[last];
+	m_Types[index] = m_Types[last];
+	m_IsAlive[index] = m_IsAlive[last];
+	m_IsShooting[index] = m_IsShooting[last];
+	m_EntityIds[index] = m_EntityIds[last];
+
+	m_Positions.pop_back();
+	m_PreviousPositions.pop_back();
+	m_VerticalDirections.pop_back();
+	m_TimeElapsed.pop_back();
+	m_ShootCooldowns.pop_back();
+	m_Difficulties.pop_back();
+	m_Types.pop_back();
+	m_IsAlive.pop_back();
+	m_IsShooting.pop_back();
+	m_EntityIds.pop_back();
+}
@@ -0,0 +1,317 @@
+/*!
+ * \file EnemyStore.h
+ *
+ * \brief Contains the DifficultyLevel and EnemyType enums and the EnemyStore class.
+ *
+ * The EnemyStore keeps every enemy of a level in structure-of-arrays form: each hot field (position, vertical
+ * direction, time elapsed, shoot cooldown, difficulty, type and alive flag) lives in its own contiguous array.
+ * Movement, bounds checking and shooting run as tight loops over those arrays instead of chasing one heap object per
+ * enemy. The look of each enemy type, the projectile pool and the random generator are shared by all enemies of the
+ * store; each enemy draws its random numbers from its own stream of the generator, keyed by a stable id.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "ProjectilePool.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Utility/CounterRandom.h"
+class SpriteBatch;
+
+ /**
+  * @enum DifficultyLevel
+  * @brief Represents the different difficulty levels in the game.
+  *
+  * The difficulty level impacts the behavior of enemies, such as their shooting frequency, movement speed,
+  * and chance to hit the player. The levels range from VERY_EASY to INSANE.
+  */
+enum class DifficultyLevel
+{
+	VERY_EASY = 0, ///< Very easy difficulty level
+	EASY,          ///< Easy difficulty level
+	NORMAL,        ///< Normal difficulty level
+	HARD,          ///< Hard difficulty level
+	VERY_HARD,     ///< Very hard difficulty level
+	INSANE         ///< Insane difficulty level
+};
+
+/// Number of entries in DifficultyLevel
+constexpr std::size_t DIFFICULTY_LEVEL_COUNT = 6;
+
+/**
+ * @enum EnemyType
+ * @brief The kinds of enemy a store can hold, which only differ in looks and hitbox.
+ */
+enum class EnemyType : std::uint8_t
+{
+	PIG = 0, ///< The pig, the enemy of the first wave
+	COW      ///< The cow
+};
+
+/// Number of entries in EnemyType
+constexpr std::size_t ENEMY_TYPE_COUNT = 2;
+
+/**
+ * @class EnemyStore
+ * @brief Stores and simulates all enemies of a level, one array per field.
+ *
+ * Enemies are addressed by index. Killing an enemy only clears its alive flag; RemoveDead() later compacts all
+ * arrays with swap-and-pop, so indices are stable for the duration of a collision pass but not across passes.
+ */
+class EnemyStore
+{
+public:
+	/**
+	 * @brief Constructs an empty store and looks up the sprite of every enemy type.
+	 *
+	 * @param projectileFile The texture file shared by every enemy projectile.
+	 * @param projectileCapacity The maximum number of enemy projectiles in flight at the same time.
+	 */
+	EnemyStore(const std::string& projectileFile, std::size_t projectileCapacity = 4096);
+
+	/**
+	 * @brief Adds a new enemy to the store.
+	 *
+	 * The enemy gets the next entity id and a random delay of up to a second before its first shot, drawn from its own
+	 * stream so the formation does not fire in unison.
+	 *
+	 * @param position The starting position of the enemy.
+	 * @param difficultyLevel The difficulty level that influences the enemy's shooting behavior.
+	 * @param type The kind of enemy, which sets its sprite and hitbox.
+	 * @return The index of the new enemy.
+	 */
+	std::size_t Spawn(const Vector2f& position, DifficultyLevel difficultyLevel, EnemyType type = EnemyType::PIG);
+
+	/**
+	 * @brief Reserves storage for a number of enemies so spawning a wave does not reallocate.
+	 *
+	 * @param count The number of enemies to reserve space for.
+	 */
+	void Reserve(std::size_t count);
+
+	/**
+	 * @brief Updates every enemy and every enemy projectile.
+	 *
+	 * Enemy movement and the projectiles already in flight do not depend on each other, so both run as jobs at the
+	 * same time. Shooting waits for the enemies to have moved, and dead projectiles are released once every job
+	 * finished.
+	 *
+	 * @param deltaTime The time elapsed since the last frame (in seconds).
+	 */
+	void Update(float deltaTime);
+
+	/**
+	 * @brief Adds every alive enemy and every enemy projectile to a sprite batch.
+	 *
+	 * @param batch The sprite batch collecting the frame's quads.
+	 * @param alpha How far rendering is between the previous tick (0) and the current tick (1).
+	 */
+	void Draw(SpriteBatch& batch, float alpha = 1.0f) const;
+
+	/**
+	 * @brief Marks an enemy as dead. It stays in the arrays until RemoveDead() is called.
+	 *
+	 * @param index The index of the enemy to kill.
+	 */
+	inline void Kill(std::size_t index) { m_IsAlive[index] = 0; }
+
+	/**
+	 * @brief Removes every dead enemy from the arrays using swap-and-pop and reports each death to the GameEventQueue.
+	 */
+	void RemoveDead();
+
+	/**
+	 * @brief Removes every enemy and enemy projectile, keeping the allocated storage.
+	 */
+	void Clear();
+
+	/**
+	 * @brief Seeds the random generator that drives enemy shooting and restarts entity ids and ticks from zero.
+	 *
+	 * Two stores seeded alike and fed the same spawns and ticks make exactly the same decisions.
+	 *
+	 * @param seed The seed value.
+	 */
+	void Seed(std::uint64_t seed);
+
+	// Getters
+
+	/**
+	 * @brief Gets the number of enemies in the store, dead ones included until RemoveDead() runs.
+	 *
+	 * @return The number of enemies.
+	 */
+	inline std::size_t Size() const { return m_Positions.size(); }
+
+	/**
+	 * @brief Checks whether the store holds no enemies.
+	 *
+	 * @return True if there are no enemies left.
+	 */
+	inline bool IsEmpty() const { return m_Positions.empty(); }
+
+	/**
+	 * @brief Checks if an enemy is alive.
+	 *
+	 * @param index The index of the enemy.
+	 * @return True if the enemy is alive, false if dead.
+	 */
+	inline bool IsAlive(std::size_t index) const { return m_IsAlive[index] != 0; }
+
+	/**
+	 * @brief Gets the current position of an enemy.
+	 *
+	 * @param index The index of the enemy.
+	 * @return The current position of the enemy.
+	 */
+	inline const Vector2f& GetPosition(std::size_t index) const { return m_Positions[index]; }
+
+	/**
+	 * @brief Gets the hitbox of an enemy.
+	 *
+	 * @param index The index of the enemy.
+	 * @return The world-space bounding box of the enemy.
+	 */
+	inline sf::FloatRect GetBounds(std::size_t index) const
+	{
+		return sf::FloatRect(m_Positions[index], m_TypeVisuals[static_cast<std::size_t>(m_Types[index])].size);
+	}
+
+	/**
+	 * @brief Gets the pool of projectiles fired by all enemies of the store.
+	 *
+	 * @return A reference to the enemy projectile pool.
+	 */
+	inline ProjectilePool& GetProjectiles() { return m_Projectiles; }
+
+	/**
+	 * @brief Gets the pool of projectiles fired by all enemies of the store.
+	 *
+	 * @return A constant reference to the enemy projectile pool.
+	 */
+	inline const ProjectilePool& GetProjectiles() const { return m_Projectiles; }
+
+private:
+	/**
+	 * @brief Advances a range of enemies by one tick: movement, turning around and shot rolls.
+	 *
+	 * Only touches the enemies of the range, so disjoint ranges run on different job threads.
+	 *
+	 * @param deltaTime The time elapsed since the last frame (in seconds).
+	 * @param begin The first enemy to update.
+	 * @param end One past the last enemy to update.
+	 */
+	void UpdateRange(float deltaTime, std::size_t begin, std::size_t end);
+
+	/**
+	 * @brief Moves a range of enemies along their movement pattern.
+	 *
+	 * Enemies drift vertically in their current direction and sway horizontally on a sine wave.
+	 *
+	 * @param deltaTime The time elapsed since the last frame (in seconds).
+	 * @param begin The first enemy to move.
+	 * @param end One past the last enemy to move.
+	 * @param verticalSpeed The vertical movement speed of the enemies.
+	 * @param amplitude The amplitude of the horizontal movement.
+	 * @param frequency The frequency of the sine wave movement.
+	 */
+	void OnMove(float deltaTime, std::size_t begin, std::size_t end, float verticalSpeed = 50.0f, float amplitude = 50.0f, float frequency = 2.0f);
+
+	/**
+	 * @brief Reverses the vertical direction of every enemy of a range that reached a movement limit.
+	 *
+	 * @param movementLimit The height beyond which enemies turn back up.
+	 * @param begin The first enemy to check.
+	 * @param end One past the last enemy to check.
+	 */
+	void ReverseMovement(float movementLimit, std::size_t begin, std::size_t end);
+
+	/**
+	 * @brief Resolves the shooting values of every difficulty level, once per tick.
+	 *
+	 * @param baseMaxChanceToHit The base maximum chance for the enemy to hit the player.
+	 * @param baseRequiredRollToShoot The base required roll for the enemy to shoot.
+	 * @param baseCooldownDuration The base cooldown duration between shots.
+	 */
+	void UpdateShootingParameters(int baseMaxChanceToHit, int baseRequiredRollToShoot, float baseCooldownDuration);
+
+	/**
+	 * @brief Counts down the shoot cooldowns of a range of enemies and rolls for those that expired.
+	 *
+	 * The rolls come from each enemy's own stream for the current tick, drawn in one batch, so the outcome does not
+	 * depend on which job handles the range. Winners get their cooldown reset and are flagged for ProcessShooting().
+	 * The list of enemies rolling this tick is scratch taken from the FrameArena.
+	 *
+	 * @param deltaTime The time elapsed since the last frame (in seconds).
+	 * @param begin The first enemy to roll for.
+	 * @param end One past the last enemy to roll for.
+	 */
+	void RollShots(float deltaTime, std::size_t begin, std::size_t end);
+
+	/**
+	 * @brief Fires a projectile for every enemy flagged by RollShots().
+	 *
+	 * Runs on one thread, in enemy order, so projectiles land in the pool in the same order whatever the number of
+	 * cores. New projectiles are moved once straight away, as the pool's jobs for this tick only cover the
+	 * projectiles that existed before.
+	 *
+	 * @param deltaTime The time elapsed since the last frame (in seconds).
+	 */
+	void ProcessShooting(float deltaTime);
+
+	/**
+	 * @brief Moves the enemy at the back of the arrays into the given slot and shrinks the arrays by one.
+	 *
+	 * @param index The slot to overwrite.
+	 */
+	void SwapAndPop(std::size_t index);
+
+	/**
+	 * @brief Reports the capacity of the per-enemy arrays to the MemoryTracker.
+	 */
+	void UpdateMemoryReport();
+
+private:
+	// Hot per-enemy data, one array per field
+	std::vector<Vector2f> m_Positions;          ///< The current position of each enemy
+	std::vector<Vector2f> m_PreviousPositions;  ///< The position of each enemy before the last update
+	std::vector<float> m_VerticalDirections;    ///< The direction of vertical movement of each enemy
+	std::vector<float> m_TimeElapsed;           ///< Time elapsed for each enemy's movement pattern
+	std::vector<float> m_ShootCooldowns;        ///< The cooldown before each enemy's next shot attempt
+	std::vector<DifficultyLevel> m_Difficulties; ///< The difficulty level of each enemy
+	std::vector<EnemyType> m_Types;             ///< Kind of each enemy
+	std::vector<std::uint8_t> m_IsAlive;        ///< Whether each enemy is alive (1) or dead (0)
+	std::vector<std::uint8_t> m_IsShooting;     ///< Whether each enemy won its shot roll this tick
+	std::vector<std::uint32_t> m_EntityIds;     ///< Stable id of each enemy, which keys its random stream
+	TrackedMemory m_Memory;                     ///< Capacity of the per-enemy arrays, reported as entities
+
+	// Shared data
+	/**
+	 * @struct TypeVisual
+	 * @brief The sprite and hitbox shared by every enemy of one type.
+	 */
+	struct TypeVisual
+	{
+		std::shared_ptr<sf::Texture> texture; ///< The texture (or atlas page) holding the sprite
+		sf::IntRect textureRect;              ///< The region of the texture drawn for each enemy
+		Vector2f size;                        ///< The size of the hitbox
+	};
+	std::array<TypeVisual, ENEMY_TYPE_COUNT> m_TypeVisuals; ///< Indexed by EnemyType
+	ProjectilePool m_Projectiles;           ///< The projectiles fired by all enemies
+	CounterRandom m_RNG;                    ///< The random streams used to control shooting behavior
+	std::uint32_t m_NextEntityId;           ///< Id given to the next spawned enemy
+	std::uint32_t m_Tick;                   ///< Number of updates since the last Seed(), the tick of every stream
+
+	/**
+	 * @struct ShootingParameters
+	 * @brief Shooting values of one difficulty level, resolved once per tick.
+	 */
+	struct ShootingParameters
+	{
+		int requiredRollToShoot = 1;   ///< A roll at or below this value fires a projectile
+		float cooldownDuration = 1.0f; ///< Cooldown applied after a successful shot
+	};
+	std::array<ShootingParameters, DIFFICULTY_LEVEL_COUNT> m_ShootingParameters; ///< Indexed by DifficultyLevel
+	int m_MaxShotRoll;                      ///< Rolls are drawn in [1, m_MaxShotRoll]
+};
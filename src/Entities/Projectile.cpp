@@ -1,27 +1,22 @@
 #include "stdafx.h"
 #include "Projectile.h"
-#include "Enemy.h"
-#include "Spaceship.h"
 
-
-Projectile::Projectile(const std::string& fileName, const Vector2f& startingPosition, const Vector2f& direction /*= { 0, -1 }*/) 
-	: m_StartingPosition(startingPosition)
-	, m_CurrentPosition(m_StartingPosition)
-	, m_IsActive(true)
-	, m_Direction(direction)
+void Projectile::Spawn(const Vector2f& startingPosition, const Vector2f& direction, const Vector2f& size)
 {
-	m_Texture.loadFromFile(fileName);
-	m_Sprite.setTexture(m_Texture);
-	m_Sprite.setPosition(startingPosition);
-	m_Sprite.scale(0.5f, 0.5f);
-};
+	m_Position = startingPosition;
+	m_PreviousPosition = startingPosition;
+	m_Direction = direction;
+	m_Size = size;
+	m_IsActive = true;
+}
 
 void Projectile::Update(float deltaTime)
 {
+	m_PreviousPosition = m_Position;
 	MoveProjectile(deltaTime);
 
 	MoveProjectile(deltaTime);
-	if (m_Sprite.getPosition().y < -1 || m_Sprite.getPosition().y > 1080) // update bounds as needed
+	if (m_Position.y < -1 || m_Position.y > 1080) // update bounds as needed
 	{
 		m_IsActive = false;
 	}
@@ -30,10 +25,5 @@ void Projectile::Update(float deltaTime)
 void Projectile::MoveProjectile(float deltaTime)
 {
 	float speed = 300;
-	m_Sprite.move(m_Direction * speed * deltaTime);
-}
-
-void Projectile::Draw(sf::RenderWindow& window)
-{
-	window.draw(m_Sprite);
+	m_Position = m_Position + m_Direction * speed * deltaTime;
 }
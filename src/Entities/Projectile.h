@@ -4,7 +4,8 @@
  * \brief Contains the Projectile class and its related methods.
  *
  * The Projectile class represents a projectile in the game, such as a bullet or missile fired by an enemy or player.
- * It handles the movement, updating, and drawing of the projectile on the screen, as well as tracking its activation status.
+ * It handles the movement and updating of the projectile, as well as tracking its activation status.
+ * Projectiles are stored by value inside a ProjectilePool, which also owns the texture used to draw them.
  *
  * \author Felix Atanasescu - HE20830
  * \date April 2025
@@ -14,25 +15,30 @@
 
  /**
   * @class Projectile
-  * @brief Represents a projectile in the game, including its movement, appearance, and active status.
+  * @brief Represents a projectile in the game, including its movement, hitbox, and active status.
   *
-  * The Projectile class handles the initialization of a projectile, its movement over time, and drawing it to the screen.
+  * The Projectile class is a small value type: it only keeps the data needed for simulation. Rendering is done by the
+  * owning ProjectilePool with a single shared sprite, so spawning a projectile never loads or copies a texture.
   * The projectile can be set to active or inactive, depending on whether it is in flight or has collided with an object.
   */
 class Projectile
 {
 public:
 	/**
-	 * @brief Constructor to initialize the projectile with its texture, position, and direction.
+	 * @brief Default constructor, creates an inactive projectile slot.
+	 */
+	Projectile() = default;
+
+	/**
+	 * @brief (Re)initializes the projectile with its position, direction, and hitbox size.
 	 *
-	 * Initializes the projectile's texture from a file, sets its starting position, and gives it an initial direction
-	 * of movement (by default, moving upwards).
+	 * Called by the ProjectilePool when a slot is handed out for a new shot.
 	 *
-	 * @param fileName The file path to the texture for the projectile.
 	 * @param startingPosition The initial position of the projectile when it's fired.
-	 * @param direction The direction the projectile will move in. Default is upwards.
+	 * @param direction The direction the projectile will move in.
+	 * @param size The size of the projectile's hitbox in pixels.
 	 */
-	Projectile(const std::string& fileName, const Vector2f& startingPosition, const Vector2f& direction = { 0, -1 });
+	void Spawn(const Vector2f& startingPosition, const Vector2f& direction, const Vector2f& size);
 
 	/**
 	 * @brief Updates the projectile's position and checks if it's still active.
@@ -53,27 +59,33 @@ public:
 	void MoveProjectile(float deltaTime);
 
 	/**
-	 * @brief Draws the projectile to the screen.
+	 * @brief Gets the current position of the projectile.
 	 *
-	 * Renders the projectile's sprite to the window at its current position.
+	 * @return The current position of the projectile as a Vector2f.
+	 */
+	inline const Vector2f& GetPosition() const { return m_Position; }
+
+	/**
+	 * @brief Gets the position of the projectile before the last update.
 	 *
-	 * @param window The SFML render window to draw the sprite on.
+	 * @return The position at the previous simulation tick, used for render interpolation.
 	 */
-	void Draw(sf::RenderWindow& window);
+	inline const Vector2f& GetPreviousPosition() const { return m_PreviousPosition; }
 
 	/**
-	 * @brief Gets the current position of the projectile.
+	 * @brief Gets the position to draw the projectile at, between the previous and the current tick.
 	 *
-	 * @return The current position of the projectile as a Vector2f.
+	 * @param alpha How far rendering is between the previous tick (0) and the current tick (1).
+	 * @return The interpolated position.
 	 */
-	inline const Vector2f GetPosition() { return m_Sprite.getPosition(); }
+	inline Vector2f GetInterpolatedPosition(float alpha) const { return m_PreviousPosition.Lerp(m_Position, alpha); }
 
 	/**
 	 * @brief Checks if the projectile is currently active.
 	 *
 	 * @return True if the projectile is active, false if it is inactive.
 	 */
-	inline const bool IsProjectileActive() const { return m_IsActive; }
+	inline bool IsProjectileActive() const { return m_IsActive; }
 
 	/**
 	 * @brief Gets the activation status of the projectile.
@@ -85,9 +97,9 @@ public:
 	/**
 	 * @brief Gets the bounding box of the projectile for collision detection.
 	 *
-	 * @return The global bounds of the projectile sprite, which can be used for collision detection.
+	 * @return The world-space hitbox of the projectile.
 	 */
-	const sf::FloatRect& GetBounds() const { return m_Sprite.getGlobalBounds(); }
+	inline sf::FloatRect GetBounds() const { return sf::FloatRect(m_Position, m_Size); }
 
 	/**
 	 * @brief Sets the activation status of the projectile.
@@ -99,13 +111,10 @@ public:
 	inline void SetStatus(bool isActive) { m_IsActive = isActive; }
 
 private:
-	// Texture and Sprite
-	sf::Texture m_Texture; ///< The texture used for the projectile's sprite
-	sf::Sprite m_Sprite;   ///< The sprite representing the projectile in the game
-
 	// Properties
-	Vector2f m_StartingPosition; ///< The initial starting position of the projectile
-	Vector2f m_CurrentPosition;  ///< The current position of the projectile
-	Vector2f m_Direction;       ///< The direction the projectile is moving in
-	bool m_IsActive;            ///< Whether the projectile is currently active (in flight) or not
+	Vector2f m_Position;         ///< The current position of the projectile
+	Vector2f m_PreviousPosition; ///< The position of the projectile before the last update
+	Vector2f m_Direction;        ///< The direction the projectile is moving in
+	Vector2f m_Size;             ///< The size of the projectile's hitbox
+	bool m_IsActive = false;     ///< Whether the projectile is currently active (in flight) or not
 };
@@ -0,0 +1,81 @@
+#include "stdafx.h"
+#include "ProjectilePool.h"
+#include "Core/Utility/Helper.h"
+#include "Core/Rendering/SpriteBatch.h"
+#include "Core/Jobs/JobSystem.h"
+
+ProjectilePool::ProjectilePool(const std::string& textureFile, std::size_t capacity, float scale /*= 0.5f*/)
+	: m_Projectiles(capacity)
+	, m_ActiveCount(0)
+	, m_Memory(MemoryTag::ENTITIES)
+{
+	m_Memory.Resize(m_Projectiles.capacity() * sizeof(Projectile));
+
+	CoreHelper::LoadTextureAndSprite(m_Texture, m_Sprite, textureFile);
+
+	m_Sprite.setScale(scale, scale);
+	m_ProjectileSize = Vector2f(m_Sprite.getGlobalBounds().width, m_Sprite.getGlobalBounds().height);
+}
+
+Projectile* ProjectilePool::Spawn(const Vector2f& startingPosition, const Vector2f& direction /*= { 0.0f, -1.0f }*/)
+{
+	// No free slot left, drop the shot instead of growing the pool
+	if (m_ActiveCount == m_Projectiles.size())
+	{
+		return nullptr;
+	}
+
+	// The first free slot sits right after the last live projectile
+	Projectile& projectile = m_Projectiles[m_ActiveCount++];
+	projectile.Spawn(startingPosition, direction, m_ProjectileSize);
+	return &projectile;
+}
+
+void ProjectilePool::Update(float deltaTime)
+{
+	JobSystem::Get().ParallelFor(m_ActiveCount, JOB_GRAIN_SIZE, [this, deltaTime](std::size_t begin, std::size_t end)
+		{
+			UpdateRange(deltaTime, begin, end);
+		});
+
+	RemoveInactive();
+}
+
+void ProjectilePool::UpdateRange(float deltaTime, std::size_t begin, std::size_t end)
+{
+	for (std::size_t i = begin; i < end; ++i)
+	{
+		m_Projectiles[i].Update(deltaTime);
+	}
+}
+
+void ProjectilePool::RemoveInactive()
+{
+	std::size_t index = 0;
+	while (index < m_ActiveCount)
+	{
+		if (m_Projectiles[index].IsProjectileActive())
+		{
+			++index;
+			continue;
+		}
+
+		// Move the last live projectile into the hole, do not advance so it gets checked too
+		m_Projectiles[index] = m_Projectiles[--m_ActiveCount];
+	}
+}
+
+void ProjectilePool::Draw(SpriteBatch& batch, float alpha /*= 1.0f*/) const
+{
+	if (m_Texture == nullptr)
+	{
+		return;
+	}
+
+	const sf::IntRect& textureRect = m_Sprite.getTextureRect();
+	const Vector2f scale(m_Sprite.getScale().x, m_Sprite.getScale().y);
+	for (const Projectile& projectile : *this)
+	{
+		batch.Draw(*m_Texture, textureRect, projectile.GetInterpolatedPosition(alpha), scale);
+	}
+}
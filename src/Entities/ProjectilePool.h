@@ -0,0 +1,127 @@
+/*!
+ * \file ProjectilePool.h
+ *
+ * \brief Contains the ProjectilePool class, a fixed-capacity container for projectiles.
+ *
+ * The pool stores projectiles by value in a single block allocated up front, so firing a shot never
+ * touches the heap. Live projectiles are kept densely packed at the front of the block; removing one
+ * swaps the last live projectile into its slot (swap-and-pop), which makes the free slots a contiguous
+ * free list at the tail of the block.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include "Projectile.h"
+#include "Core/Memory/MemoryTracker.h"
+class SpriteBatch;
+
+/**
+ * @class ProjectilePool
+ * @brief Owns every projectile fired by one shooter, plus the texture used to draw them.
+ *
+ * Spawning takes the first free slot, removal swaps with the last live projectile, and iteration only visits
+ * live projectiles. Order is not preserved, which is fine because projectiles never depend on each other.
+ */
+class ProjectilePool
+{
+public:
+	static constexpr std::size_t JOB_GRAIN_SIZE = 2048; ///< Projectiles updated per job; a few microseconds of work each
+
+	/**
+	 * @brief Constructs the pool and reserves storage for all of its projectiles.
+	 *
+	 * @param textureFile The file path of the texture shared by every projectile in the pool.
+	 * @param capacity The maximum number of projectiles alive at the same time.
+	 * @param scale The scale applied to the projectile texture when drawing and for hitboxes.
+	 */
+	ProjectilePool(const std::string& textureFile, std::size_t capacity, float scale = 0.5f);
+
+	/**
+	 * @brief Activates a projectile from the free list.
+	 *
+	 * If the pool is full the shot is dropped, as growing the pool would allocate on the hot path.
+	 *
+	 * @param startingPosition The position where the projectile will spawn.
+	 * @param direction The direction in which the projectile will move (default is upwards).
+	 * @return A pointer to the spawned projectile, or nullptr if the pool is full.
+	 */
+	Projectile* Spawn(const Vector2f& startingPosition, const Vector2f& direction = { 0.0f, -1.0f });
+
+	/**
+	 * @brief Updates every live projectile and releases the ones that became inactive.
+	 *
+	 * Large pools are updated in parallel on the JobSystem.
+	 *
+	 * @param deltaTime The time elapsed since the last frame (in seconds).
+	 */
+	void Update(float deltaTime);
+
+	/**
+	 * @brief Moves a range of live projectiles without releasing the inactive ones.
+	 *
+	 * Only touches the projectiles of the range, so disjoint ranges run on different job threads.
+	 *
+	 * @param deltaTime The time elapsed since the last frame (in seconds).
+	 * @param begin The first projectile to update.
+	 * @param end One past the last projectile to update.
+	 */
+	void UpdateRange(float deltaTime, std::size_t begin, std::size_t end);
+
+	/**
+	 * @brief Releases every inactive projectile back to the free list using swap-and-pop.
+	 */
+	void RemoveInactive();
+
+	/**
+	 * @brief Adds every live projectile to a sprite batch, so the whole pool is drawn with one draw call.
+	 *
+	 * @param batch The sprite batch collecting the frame's quads.
+	 * @param alpha How far rendering is between the previous tick (0) and the current tick (1).
+	 */
+	void Draw(SpriteBatch& batch, float alpha = 1.0f) const;
+
+	/**
+	 * @brief Releases every projectile without freeing the pool's storage.
+	 */
+	inline void Clear() { m_ActiveCount = 0; }
+
+	/**
+	 * @brief Gets the number of live projectiles.
+	 *
+	 * @return The number of projectiles currently in use.
+	 */
+	inline std::size_t Size() const { return m_ActiveCount; }
+
+	/**
+	 * @brief Gets the maximum number of live projectiles.
+	 *
+	 * @return The capacity the pool was created with.
+	 */
+	inline std::size_t Capacity() const { return m_Projectiles.size(); }
+
+	/**
+	 * @brief Checks whether the pool has no live projectiles.
+	 *
+	 * @return True if no projectile is in use.
+	 */
+	inline bool IsEmpty() const { return m_ActiveCount == 0; }
+
+	// Iteration over live projectiles only
+	inline Projectile* begin() { return m_Projectiles.data(); }
+	inline Projectile* end() { return m_Projectiles.data() + m_ActiveCount; }
+	inline const Projectile* begin() const { return m_Projectiles.data(); }
+	inline const Projectile* end() const { return m_Projectiles.data() + m_ActiveCount; }
+
+private:
+	// Storage
+	std::vector<Projectile> m_Projectiles; ///< Fixed block of projectiles, live ones first, free slots after
+	std::size_t m_ActiveCount;             ///< Number of live projectiles at the front of the block
+	TrackedMemory m_Memory;                ///< The block, reported as entities
+
+	// Rendering
+	std::shared_ptr<sf::Texture> m_Texture; ///< The shared texture used for every projectile
+	sf::Sprite m_Sprite;                    ///< The sprite holding the texture region and scale of a projectile
+	Vector2f m_ProjectileSize;              ///< The scaled size of a projectile, used for hitboxes
+};
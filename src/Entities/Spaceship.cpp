@@ -2,67 +2,67 @@
 #include "Spaceship.h"
 #include "Core/Managers/InputManager.h"
 #include "Core/Managers/SoundManager.h"
-#include "Enemy.h"
-#include "Core/Utility/strings.h"
+#include "Core/Managers/GameEventQueue.h"
+#include "Core/Utility/Helper.h"
+#include "EnemyStore.h"
+#include "Core/Rendering/SpriteBatch.h"
+#include "Core/Utility/Strings.h"
 #include "Core/Utility/GameplayUtility.h"
-#include "Entities/Projectile.h"
 
-static SoundManager g_ShootSound;
-static SoundManager g_DeadSound;
+// Maximum number of player projectiles in flight at the same time
+constexpr std::size_t SPACESHIP_PROJECTILE_CAPACITY = 256;
+
+// ********************* SPACESHIP SOUND CONSTANTS ********************
+constexpr int SHOOT_SOUND_INSTANCES = 4;        // Rapid fire overlaps up to this many shots
+constexpr int SHOOT_SOUND_PRIORITY = 0;         // The most frequent sound, the first to be cut
+constexpr int HIT_SOUND_INSTANCES = 1;
+constexpr int HIT_SOUND_PRIORITY = 2;           // Losing a life must always be heard
+// ****************************************************
 
 Spaceship::Spaceship()
-	: m_IsAlive(true)
+	: m_Projectiles(BOMB, SPACESHIP_PROJECTILE_CAPACITY)
+	, m_IsAlive(true)
 {
-	m_Texture.loadFromFile(SPACESHIP);
-	m_Sprite.setTexture(m_Texture);
-	g_ShootSound.LoadSound("shoot", SHOOTING_SOUND);
-	g_DeadSound.LoadSound("dead", SPACESHIP_HIT);
+	CoreHelper::LoadTextureAndSprite(m_Texture, m_Sprite, SPACESHIP);
+	SoundManager::Get().LoadSound(SoundID::SHOOT, SHOOTING_SOUND, SHOOT_SOUND_INSTANCES, SHOOT_SOUND_PRIORITY);
+	SoundManager::Get().LoadSound(SoundID::SPACESHIP_HIT, SPACESHIP_HIT, HIT_SOUND_INSTANCES, HIT_SOUND_PRIORITY);
 }
 
-void Spaceship::Update(sf::RenderWindow& window, std::vector<std::unique_ptr<Enemy>>& cows, float deltaTime)
+void Spaceship::Update(const Vector2i& cursorPosition, EnemyStore& cows, float deltaTime)
 {
-	CalculateAndUpdateCursorPosition(window);
+	CalculateAndUpdateCursorPosition(cursorPosition);
 	OnProjectileShoot();
 	UpdateProjectiles(deltaTime);
 }
 
-void Spaceship::Draw(sf::RenderWindow& window)
+void Spaceship::Draw(SpriteBatch& batch, float alpha /*= 1.0f*/)
 {
-	DrawProjectile(window);
-	DrawSpaceship(window);
+	DrawProjectile(batch, alpha);
+	DrawSpaceship(batch);
 }
 
 void Spaceship::OnHit()
 {
-	g_DeadSound.PlaySoundW("dead");
+	GameEventQueue::Get().Push(GameEventType::PLAYER_HIT, Vector2f(m_Sprite.getPosition()));
 }
 
 void Spaceship::OnProjectileShoot()
 {
 	if (InputManager::Get().IsKeyPress(KeyBind::Shoot))
 	{
-		g_ShootSound.PlaySound("shoot");
-		GameplayUtility::SpawnProjectile(m_Projectiles, BOMB, m_Sprite.getPosition());
+		GameEventQueue::Get().Push(GameEventType::SHOT_FIRED, Vector2f(m_Sprite.getPosition()));
+		GameplayUtility::SpawnProjectile(m_Projectiles, m_Sprite.getPosition());
 	}
 }
 
 void Spaceship::UpdateProjectiles(float deltaTime)
 {
-	// Update active projectiles
-	for (const auto& projectile : m_Projectiles)
-	{
-		projectile->Update(deltaTime);
-	}
-
-	// Remove inactive projectiles
-	GameplayUtility::RemoveInactiveProjectiles(m_Projectiles);
+	// Update active projectiles and return inactive ones to the pool
+	m_Projectiles.Update(deltaTime);
 }
 
-void Spaceship::CalculateAndUpdateCursorPosition(sf::RenderWindow& window)
+void Spaceship::CalculateAndUpdateCursorPosition(const Vector2i& cursorPosition)
 {
-	// Get mouse position and set cursor
-	Vector2i cursorPosition = sf::Mouse::getPosition(window);
-
 	// Get sprite size
 	Vector2f spriteSize(m_Sprite.getGlobalBounds().width, m_Sprite.getGlobalBounds().height);
 
@@ -70,19 +70,16 @@ void Spaceship::CalculateAndUpdateCursorPosition(sf::RenderWindow& window)
 	m_Sprite.setPosition(static_cast<float>(cursorPosition.x) - spriteSize.x / 2, static_cast<float>(cursorPosition.y) - spriteSize.y / 2);
 }
 
-void Spaceship::DrawProjectile(sf::RenderWindow& window)
+void Spaceship::DrawProjectile(SpriteBatch& batch, float alpha)
 {
-	for (const auto& it : m_Projectiles)
-	{
-		it->Draw(window);
-	}
+	m_Projectiles.Draw(batch, alpha);
 }
 
-void Spaceship::DrawSpaceship(sf::RenderWindow& window)
+void Spaceship::DrawSpaceship(SpriteBatch& batch)
 {
 	if (m_IsAlive)
 	{
-		window.draw(m_Sprite);
+		batch.Draw(m_Sprite);
 	}
 }
 
@@ -11,8 +11,9 @@
  */
 
 #pragma once
-#include "Projectile.h"
-class Enemy;
+#include "ProjectilePool.h"
+class EnemyStore;
+class SpriteBatch;
 
  /**
   * @class Spaceship
@@ -36,29 +37,41 @@ public:
 	 * @brief Updates the spaceship's state and actions.
 	 *
 	 * This function should be called each frame to update the spaceship's state, such as its position, firing projectiles,
-	 * and any necessary interactions with other game entities like enemies.
+	 * and any necessary interactions with other game entities like enemies. The cursor position comes from the caller,
+	 * normally InputManager::GetCursorPosition(), so recorded and scripted input drive the spaceship like the mouse.
 	 *
-	 * @param window The SFML render window to calculate and update positions.
-	 * @param cows A vector of unique pointers to enemies (or "cows" as they may be called in this context).
+	 * @param cursorPosition The cursor position the spaceship is centred on.
+	 * @param cows The store holding the enemies (or "cows" as they may be called in this context).
 	 * @param deltaTime The time elapsed since the last frame (in seconds).
 	 */
-	void Update(sf::RenderWindow& window, std::vector<std::unique_ptr<Enemy>>& cows, float deltaTime);
+	void Update(const Vector2i& cursorPosition, EnemyStore& cows, float deltaTime);
 
 	/**
 	 * @brief Draws the spaceship and its projectiles to the screen.
 	 *
-	 * Renders the spaceship and its active projectiles to the window.
+	 * Adds the spaceship and its active projectiles to the frame's sprite batch.
 	 *
-	 * @param window The SFML render window to draw the spaceship and projectiles on.
+	 * The spaceship itself is drawn at its latest position so it stays glued to the cursor; only its projectiles
+	 * are interpolated between ticks.
+	 *
+	 * @param batch The sprite batch collecting the frame's quads.
+	 * @param alpha How far rendering is between the previous tick (0) and the current tick (1).
+	 */
+	void Draw(SpriteBatch& batch, float alpha = 1.0f);
+
+	/**
+	 * @brief Gets the pool of projectiles currently fired by the spaceship.
+	 *
+	 * @return A reference to the spaceship's projectile pool.
 	 */
-	void Draw(sf::RenderWindow& window);
+	ProjectilePool& GetProjectiles() { return m_Projectiles; }
 
 	/**
-	 * @brief Gets the list of projectiles currently fired by the spaceship.
+	 * @brief Gets the pool of projectiles currently fired by the spaceship.
 	 *
-	 * @return A reference to the vector containing unique pointers to the spaceship's projectiles.
+	 * @return A const reference to the spaceship's projectile pool.
 	 */
-	std::vector<std::unique_ptr<Projectile>>& GetProjectiles() { return m_Projectiles; }
+	const ProjectilePool& GetProjectiles() const { return m_Projectiles; }
 
 	/**
 	 * @brief Gets the spaceship's sprite.
@@ -93,7 +106,7 @@ private:
 	/**
 	 * @brief Handles the spaceship firing a projectile.
 	 *
-	 * This function is responsible for instantiating new projectiles and adding them to the spaceship's list of projectiles.
+	 * This function is responsible for spawning new projectiles from the spaceship's projectile pool.
 	 */
 	void OnProjectileShoot();
 
@@ -112,36 +125,37 @@ private:
 	 *
 	 * This function updates the spaceship's position according to the cursor or player input.
 	 *
-	 * @param window The SFML render window used to track the cursor position.
+	 * @param cursorPosition The cursor position, in window coordinates.
 	 */
-	void CalculateAndUpdateCursorPosition(sf::RenderWindow& window);
+	void CalculateAndUpdateCursorPosition(const Vector2i& cursorPosition);
 
 	/**
 	 * @brief Draws all active projectiles to the window.
 	 *
 	 * This function is responsible for rendering each projectile fired by the spaceship.
 	 *
-	 * @param window The SFML render window used to draw the projectiles.
+	 * @param batch The sprite batch used to draw the projectiles.
+	 * @param alpha How far rendering is between the previous tick (0) and the current tick (1).
 	 */
-	void DrawProjectile(sf::RenderWindow& window);
+	void DrawProjectile(SpriteBatch& batch, float alpha);
 
 	/**
 	 * @brief Draws the spaceship to the window.
 	 *
 	 * This function is responsible for rendering the spaceship sprite to the screen.
 	 *
-	 * @param window The SFML render window used to draw the spaceship.
+	 * @param batch The sprite batch used to draw the spaceship.
 	 */
-	void DrawSpaceship(sf::RenderWindow& window);
+	void DrawSpaceship(SpriteBatch& batch);
 
 private:
 	// Texture and Sprite for the spaceship
-	sf::Texture m_Texture; ///< The texture used for the spaceship's sprite
+	std::shared_ptr<sf::Texture> m_Texture; ///< The shared texture used for the spaceship's sprite
 	sf::Sprite m_Sprite;   ///< The sprite representing the spaceship in the game
 	Vector2f m_Position;   ///< The current position of the spaceship
 
 	// Projectiles fired by the spaceship
-	std::vector<std::unique_ptr<Projectile>> m_Projectiles; ///< List of projectiles fired by the spaceship
+	ProjectilePool m_Projectiles; ///< Fixed-capacity pool of projectiles fired by the spaceship
 
 	// State
 	bool m_IsAlive; ///< Whether the spaceship is alive or destroyed
@@ -1,29 +1,126 @@
 #include "stdafx.h"
 #include "GameInstance.h"
-#include "Core/Utility/strings.h"
+#include "Core/Utility/Strings.h"
 #include "Scenes/InGame/LevelOne.h"
 #include "Scenes/InGame/LevelTwo.h"
 #include "Scenes/MainMenu/MainMenu.h"
 #include "Scenes/GameOver/GameOver.h"
 #include "Scenes/Credits/Credits.h"
+#include "Scenes/Intro/Intro.h"
 #include "Core/Managers/InputManager.h"
+#include "Core/Managers/ResourceCache.h"
+#include "Core/Managers/AssetPack.h"
+#include "Core/Utility/Helper.h"
+#include "Core/Rendering/RenderStats.h"
+#include "Core/Managers/GameEventQueue.h"
+#include "Core/Memory/FrameArena.h"
+#include "Core/Memory/AllocationCounter.h"
+#include "Core/Memory/MemoryTracker.h"
 
 const sf::Color RED_COLOR = { 120,6,6 };
 constexpr const char* GAME_NAME = "MOO WARS";
 constexpr int DEFAULT_RESOLUTION_WIDTH = 1920;
 constexpr int DEFAULT_RESOLUTION_HEIGHT = 1080;
 
+// ********************* FIXED TIMESTEP ********************
+constexpr float DEFAULT_TICK_RATE = 120.0f;     // Simulation ticks per second
+constexpr int DEFAULT_MAX_CATCH_UP_STEPS = 8;   // Ticks allowed in one frame before time is dropped
+constexpr float MAX_FRAME_TIME = 0.25f;         // Longest frame fed to the accumulator, in seconds
+// ****************************************************
+
+// ********************* LOADING ********************
+constexpr float LOADING_FRAME_BUDGET = 0.004f;  // Main thread time spent finishing loaded assets per frame, in seconds
+// ****************************************************
+
+// ********************* PROFILING ********************
+constexpr const char* TRACE_FILE = "moo_trace.json";        // Chrome trace written on F9 and on exit (MOO_PROFILE builds)
+constexpr sf::Keyboard::Key TRACE_DUMP_KEY = sf::Keyboard::F9;
+constexpr sf::Keyboard::Key PERF_OVERLAY_KEY = sf::Keyboard::F3;
+constexpr const char* MEMORY_REPORT_FILE = "moo_memory.txt"; // Memory report appended on every scene switch and on exit
+// ****************************************************
+
 GameInstance::GameInstance()
-	: m_deltaTime(0.0f)
+	: m_FixedDeltaTime(1.0f / DEFAULT_TICK_RATE)
+	, m_Accumulator(0.0f)
+	, m_MaxCatchUpSteps(DEFAULT_MAX_CATCH_UP_STEPS)
+	, m_IsLoading(true)
+	, m_IsReplayingInput(false)
 {
-	InitResources();
+	MOO_PROFILE_THREAD("Main");
+	MemoryTracker::Get().SetReportFile(MEMORY_REPORT_FILE);
+
+	// Map the asset pack before the first asset is requested; without one, assets load from the loose files
+	AssetPack::Get().Open(ASSET_PACK);
+
+	// Only the window and the loading screen are created up front, the game scenes wait for their assets
 	InitWindow();
-	InitGameStates();
+	InitLoadingScreen();
+	InitResources();
+	m_PerfOverlay.Init(m_Window.getSize());
+
+	// From here on only the render thread touches the window's GL context
+	m_RenderThread.Start(m_Window);
 }
 
 void GameInstance::InitResources()
 {
+	ResourceCache& cache = ResourceCache::Get();
+
+	// Standalone textures
+	cache.PreloadTexture(GAME_BACKGROUND);
+	cache.PreloadTexture(MAIN_MENU_BACKGROUND);
+	cache.PreloadTexture(BUTTONS_SPRITESHEET);
+
+	// Fonts
+	cache.PreloadFont(FONT_A);
+	cache.PreloadFont(FONT_C);
+
+	// Sound effects
+	cache.PreloadSoundBuffer(COW_DEATH);
+	cache.PreloadSoundBuffer(SHOOTING_SOUND);
+	cache.PreloadSoundBuffer(SPACESHIP_HIT);
+
+	// Pack every in-game sprite into the atlas so a whole scene draws with one texture bind
+	std::vector<std::string> atlasImages =
+	{
+		COW, PIG,
+		EGG, BOMB, COW_PROJECTILE,
+		SPACESHIP,
+		CURSOR,
+		HEALTH_BOTTLE_FULL, HEALTH_BOTTLE_1, HEALTH_BOTTLE_2, HEALTH_BOTTLE_3, HEALTH_BOTTLE_4
+	};
+
+	for (int wave = 1; wave <= WAVE_BANNER_COUNT; ++wave)
+	{
+		atlasImages.push_back(CoreHelper::GetWaveBannerPath(wave));
+	}
+
+	cache.PreloadAtlas(atlasImages);
+	m_LoadingClock.restart();
+}
+
+void GameInstance::InitLoadingScreen()
+{
+	m_StateManager.Add(std::make_shared<Intro>(m_StateManager, m_Window), SceneID::INTRO);
+	m_StateManager.Switch(SceneID::INTRO);
+}
+
+void GameInstance::UpdateLoading()
+{
+	if (!ResourceCache::Get().FinishPendingLoads(LOADING_FRAME_BUDGET))
+	{
+		return;
+	}
+
+	m_IsLoading = false;
+	Log::Print("Assets loaded in seconds", m_LoadingClock.getElapsedTime().asSeconds());
 
+	// The loading screen is destroyed below and the new scenes measure their texts, loading glyphs into the fonts; let
+	// the render thread finish its last frame first
+	m_RenderThread.WaitIdle();
+
+	// Every scene now finds its assets in the cache; the loading screen is no longer needed
+	InitGameStates();
 }
 
 void GameInstance::InitWindow()
@@ -31,9 +128,11 @@ void GameInstance::InitWindow()
 	m_Window.create(sf::VideoMode(DEFAULT_RESOLUTION_WIDTH, DEFAULT_RESOLUTION_HEIGHT), GAME_NAME, sf::Style::Close);
 	m_Window.setMouseCursorVisible(false);
 	m_Window.setMouseCursorGrabbed(true);
+	m_Window.setVerticalSyncEnabled(true); // Render at the monitor rate, the simulation has its own tick rate
+	InputManager::Get().SetWindow(&m_Window);
 
 	sf::Image icon; 
-	if (!icon.loadFromFile(COW))
+	if (!AssetPack::Get().Load(icon, COW))
 	{
 		return;
 	}
@@ -55,17 +154,30 @@ void GameInstance::InitGameStates()
 	m_StateManager.Add(levelTwo, SceneID::LEVEL_TWO);
 	m_StateManager.Add(gameOverState, SceneID::GAME_OVER);
 	m_StateManager.Add(creditState, SceneID::CREDITS);
+	m_StateManager.Remove(SceneID::INTRO);
 	m_StateManager.Switch(SceneID::MAIN_MENU);
 }
 
 void GameInstance::HandleEvent()
 {
+	MOO_PROFILE_FUNCTION();
 	while (m_Window.pollEvent(m_Event))
 	{
 		switch (m_Event.type)
 		{
 		case sf::Event::Closed:
-			m_Window.close();
+			m_StateManager.RequestQuit();
+			break;
+
+		case sf::Event::KeyPressed:
+			if (m_Event.key.code == TRACE_DUMP_KEY)
+			{
+				MOO_PROFILE_DUMP(TRACE_FILE);
+			}
+			else if (m_Event.key.code == PERF_OVERLAY_KEY)
+			{
+				m_PerfOverlay.Toggle();
+			}
 			break;
 
 		default:
@@ -76,30 +188,158 @@ void GameInstance::HandleEvent()
 
 void GameInstance::HandleInput()
 {
-	m_StateManager.HandleInput(m_deltaTime);
+	MOO_PROFILE_FUNCTION();
+	m_StateManager.HandleInput(m_FixedDeltaTime);
 }
 
 void GameInstance::Run()
 {
-	while (m_Window.isOpen())
+	m_Clock.restart();
+	while (m_Window.isOpen() && !m_StateManager.IsQuitRequested())
 	{
+		MOO_PROFILE_SCOPE("Frame");
+
 		Cursor::Get().Update();
-		HandleInput();
 		HandleEvent();
-		Update();
-		Draw(); 
-		m_deltaTime = m_Clock.restart().asSeconds();
+
+		if (m_IsLoading)
+		{
+			MOO_PROFILE_SCOPE("UpdateLoading");
+			UpdateLoading();
+		}
+
+		// Clamp huge frames (window dragged, debugger break) before they reach the accumulator
+		const float frameTime = m_Clock.restart().asSeconds();
+		m_PerfOverlay.AddFrameTime(frameTime);
+		m_Accumulator += std::min(frameTime, MAX_FRAME_TIME);
+
+		// Consume the elapsed time in fixed ticks
+		int steps = 0;
+		while (m_Accumulator >= m_FixedDeltaTime && steps < m_MaxCatchUpSteps)
+		{
+			AllocationCounter::Scope countAllocations;
+			HandleInput();
+			Update();
+			m_Accumulator -= m_FixedDeltaTime;
+			++steps;
+		}
+
+		// Still behind after the catch-up cap: drop the backlog rather than spiral
+		if (m_Accumulator >= m_FixedDeltaTime)
+		{
+			m_Accumulator = std::fmod(m_Accumulator, m_FixedDeltaTime);
+		}
+
+		DispatchGameEvents(frameTime);
+
+		Draw(m_Accumulator / m_FixedDeltaTime);
+
+		// A replay is a measurement run, it ends with its last recorded tick
+		if (m_IsReplayingInput && !InputManager::Get().IsPlayingBack())
+		{
+			m_StateManager.RequestQuit();
+		}
+
+		// Scratch memory of this frame is dead from here on
+		FrameArena::Get().Reset();
+		AllocationCounter::EndFrame();
+		MemoryTracker::Get().EndFrame();
+	}
+
+	// The window can only close once the render thread let go of it
+	m_RenderThread.Stop();
+	m_Window.close();
+	InputManager::Get().SetWindow(nullptr);
+
+	if (!m_InputRecordingPath.empty())
+	{
+		InputManager::Get().StopRecording(m_InputRecordingPath);
+	}
+
+	MemoryTracker::Get().Report("exit");
+	MOO_PROFILE_DUMP(TRACE_FILE);
+}
+
+void GameInstance::SetTickRate(float ticksPerSecond)
+{
+	if (ticksPerSecond <= 0.0f)
+	{
+		Log::Print("Tick rate must be positive", LogLevel::WARNING);
+		return;
 	}
+
+	m_FixedDeltaTime = 1.0f / ticksPerSecond;
+}
+
+void GameInstance::SetMaxCatchUpSteps(int maxSteps)
+{
+	m_MaxCatchUpSteps = std::max(1, maxSteps);
+}
+
+void GameInstance::RecordInput(const std::string& path)
+{
+	m_InputRecordingPath = path;
+	InputManager::Get().StartRecording(1.0f / m_FixedDeltaTime);
+}
+
+bool GameInstance::ReplayInput(const std::string& path)
+{
+	InputManager& input = InputManager::Get();
+	if (!input.StartPlayback(path))
+	{
+		return false;
+	}
+
+	// Recorded input is per tick, replaying it at another rate would simulate a different game
+	const float recordedTickRate = input.GetPlaybackTickRate();
+	if (std::lround(recordedTickRate) != std::lround(1.0f / m_FixedDeltaTime))
+	{
+		Log::Print("Replaying at the recorded tick rate", recordedTickRate, LogLevel::WARNING);
+		SetTickRate(recordedTickRate);
+	}
+
+	m_IsReplayingInput = true;
+	return true;
+}
+
+void GameInstance::DispatchGameEvents(float frameTime)
+{
+	MOO_PROFILE_FUNCTION();
+
+	// Everything the ticks of this frame reported is handled here, once
+	GameEventQueue& events = GameEventQueue::Get();
+	m_SoundEvents.Consume(events, frameTime);
+	events.Clear();
 }
 
 void GameInstance::Update()
 {
-	m_StateManager.Update(m_deltaTime);
+	MOO_PROFILE_FUNCTION();
+	m_StateManager.Update(m_FixedDeltaTime);
 }
 
-void GameInstance::Draw()
+void GameInstance::Draw(float alpha)
 {
-	m_Window.clear();
-	m_StateManager.Draw(m_Window);
-	m_Window.display();
+	MOO_PROFILE_FUNCTION();
+	RenderStats::Get().BeginFrame();
+
+	// The back snapshot was drawn already, record the new frame over it
+	RenderSnapshot& snapshot = m_RenderThread.GetBackSnapshot();
+	snapshot.Clear();
+	{
+		AllocationCounter::Scope countAllocations;
+		m_StateManager.Draw(snapshot, alpha);
+	}
+
+	if (m_PerfOverlay.IsVisible())
+	{
+		MOO_PROFILE_SCOPE("PerfOverlay");
+		SceneStats stats;
+		m_StateManager.CollectStats(stats);
+		m_PerfOverlay.Update(stats);
+		m_PerfOverlay.Draw(snapshot);
+	}
+
+	// Waits for the render thread to finish the previous frame, at most one frame behind
+	m_RenderThread.Submit();
 }
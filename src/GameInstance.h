@@ -10,6 +10,9 @@
  * \date April 2025
  */
 #pragma once
+#include "Core/Rendering/PerfOverlay.h"
+#include "Core/Managers/SoundEventPlayer.h"
+#include "Core/Rendering/RenderThread.h"
 
  /**
   * @class GameInstance
@@ -43,14 +46,67 @@ public:
      */
     void Run();
 
+    /**
+     * @brief Sets how many simulation ticks run per second.
+     *
+     * Update() always receives 1 / ticksPerSecond as its delta time, whatever the display rate is.
+     *
+     * @param ticksPerSecond The simulation rate, in ticks per second. Ignored if not positive.
+     */
+    void SetTickRate(float ticksPerSecond);
+
+    /**
+     * @brief Sets the maximum number of ticks simulated in a single frame.
+     *
+     * When a frame takes longer than this many ticks, the remaining time is dropped instead of simulated, so a stall
+     * (for example loading a scene) slows the game down for a moment rather than making objects jump.
+     *
+     * @param maxSteps The maximum number of ticks per frame. Clamped to at least 1.
+     */
+    void SetMaxCatchUpSteps(int maxSteps);
+
+    /**
+     * @brief Records the input of the whole session, written to a file when the game exits.
+     *
+     * @param path The file the recording is saved to.
+     */
+    void RecordInput(const std::string& path);
+
+    /**
+     * @brief Replays a recorded session instead of reading the mouse and keyboard, and exits when it ends.
+     *
+     * Must be called before Run(), so the game scenes are seeded with the recorded seed. Meant for comparing frame
+     * times of the same session across builds.
+     *
+     * @param path The file written by a recorded session.
+     * @return True if the recording was loaded, false to play normally.
+     */
+    bool ReplayInput(const std::string& path);
+
 private:
     /**
      * @brief Initializes game resources.
      *
-     * This function loads all the necessary resources for the game, including textures, sounds, and maps.
+     * This function queues all the necessary resources for the game, including textures, sounds, and fonts, to be
+     * decoded in the background, and returns immediately. Gameplay sprites are packed into the texture atlas once
+     * they have all been decoded, before any scene requests them.
      */
     void InitResources();
 
+    /**
+     * @brief Shows the loading screen.
+     *
+     * The Intro scene is the only scene created before the assets are loaded.
+     */
+    void InitLoadingScreen();
+
+    /**
+     * @brief Finishes loaded assets on the main thread and creates the game scenes once all are done.
+     *
+     * Runs once per frame while loading, within a small time budget so the loading screen stays smooth.
+     */
+    void UpdateLoading();
+
     /**
      * @brief Initializes the game window.
      *
@@ -62,6 +118,7 @@ private:
      * @brief Initializes game states.
      *
      * This function sets up the initial state of the game, including any active game scenes or menus.
+     * Called once the assets are loaded; replaces the loading screen with the main menu.
      */
     void InitGameStates();
 
@@ -75,23 +132,35 @@ private:
     /**
      * @brief Handles player input.
      *
-     * This function checks for user input (keyboard, mouse, etc.) and processes it accordingly.
+     * This function checks for user input (keyboard, mouse, etc.) and processes it accordingly. Runs once per tick.
      */
     void HandleInput();
 
     /**
-     * @brief Updates the game logic.
+     * @brief Updates the game logic by one fixed tick.
      *
      * This function updates all game objects and entities, processes game mechanics, and advances the game state.
      */
     void Update();
 
     /**
-     * @brief Draws the game objects to the window.
+     * @brief Hands the gameplay events of the frame to the systems reacting to them, then clears the queue.
      *
-     * This function renders all game objects to the SFML window.
+     * Runs once per frame, after every tick of the frame, so sounds are never played from inside the simulation.
+     *
+     * @param frameTime The real duration of the frame, in seconds.
      */
-    void Draw();
+    void DispatchGameEvents(float frameTime);
+
+    /**
+     * @brief Records the game objects into a snapshot and hands it to the render thread.
+     *
+     * This function records all game objects, then the performance overlay when shown. Runs once per frame; the
+     * window itself is drawn by the render thread while the next frame is simulated.
+     *
+     * @param alpha How far the frame is between the previous tick (0) and the current tick (1).
+     */
+    void Draw(float alpha);
 
 private:
     // The SFML window for rendering
@@ -109,7 +178,26 @@ private:
     // Clock for tracking the overall game time
     sf::Clock m_Clock;  ///< The clock used to track real time for the game loop
 
-    // Time per frame (deltaTime)
-    float m_deltaTime;  ///< The time elapsed between each frame
+    // Fixed timestep
+    float m_FixedDeltaTime;  ///< The duration of one simulation tick, in seconds
+    float m_Accumulator;     ///< Real time not yet consumed by simulation ticks
+    int m_MaxCatchUpSteps;   ///< Maximum number of ticks simulated in one frame
+
+    // Asynchronous loading
+    bool m_IsLoading;           ///< True while the loading screen is shown
+    sf::Clock m_LoadingClock;   ///< Measures how long the assets took to load
+
+    // Gameplay event consumers
+    SoundEventPlayer m_SoundEvents;  ///< Plays the sounds of the frame's gameplay events
+
+    // Input recording
+    std::string m_InputRecordingPath;  ///< File the session's input is saved to on exit, empty when not recording
+    bool m_IsReplayingInput;           ///< True while a recorded session drives the game
+
+    // Debug overlay
+    PerfOverlay m_PerfOverlay;  ///< Frame time, entity counts and draw calls, toggled with F3
+
+    // Rendering, declared last so it stops before anything it draws is destroyed
+    RenderThread m_RenderThread;  ///< Draws the recorded frames on its own thread
 };
 
@@ -0,0 +1,217 @@
+#include "stdafx.h"
+#include "AssetPackBuilder.h"
+#include "Core/Managers/AssetPack.h"
+#include "Core/Managers/BakedTexture.h"
+
+namespace
+{
+	/**
+	 * @brief Rounds an offset up to the pack's data alignment.
+	 */
+	std::uint64_t AlignOffset(std::uint64_t offset)
+	{
+		const std::uint64_t alignment = AssetPack::DATA_ALIGNMENT;
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	/**
+	 * @brief Writes zero bytes until the stream reaches an offset.
+	 */
+	void PadTo(std::ofstream& file, std::uint64_t& position, std::uint64_t offset)
+	{
+		static const char zeros[AssetPack::DATA_ALIGNMENT] = {};
+		file.write(zeros, static_cast<std::streamsize>(offset - position));
+		position = offset;
+	}
+}
+
+bool AssetPackBuilder::AddDirectory(const std::string& directory, const std::vector<std::string>& excludedDirectories)
+{
+	namespace fs = std::filesystem;
+
+	std::error_code error;
+	fs::recursive_directory_iterator it(directory, error);
+	if (error)
+	{
+		Log::Print("Cannot read directory " + directory, error.message(), LogLevel::ERROR_);
+		return false;
+	}
+
+	for (; it != fs::recursive_directory_iterator(); it.increment(error))
+	{
+		const fs::directory_entry& entry = *it;
+		if (entry.is_directory())
+		{
+			const std::string name = entry.path().filename().string();
+			const bool isExcluded = std::any_of(excludedDirectories.begin(), excludedDirectories.end(),
+				[&name](const std::string& excluded) { return AssetPack::ComparePaths(name, excluded) == 0; });
+			if (isExcluded)
+			{
+				Log::Print("Skipping", entry.path().generic_string());
+				it.disable_recursion_pending();
+			}
+			continue;
+		}
+
+		if (entry.is_regular_file())
+		{
+			// Stored the way Strings.h spells it, relative to the working directory the game runs from
+			AddFile(entry.path(), entry.path().generic_string());
+		}
+	}
+
+	return true;
+}
+
+void AssetPackBuilder::AddFile(const std::filesystem::path& sourceFile, const std::string& packedPath)
+{
+	std::error_code error;
+	const std::uintmax_t size = std::filesystem::file_size(sourceFile, error);
+	if (error)
+	{
+		Log::Print("Cannot read " + sourceFile.generic_string(), error.message(), LogLevel::ERROR_);
+		return;
+	}
+
+	std::string path = packedPath;
+	std::replace(path.begin(), path.end(), '\\', '/');
+	m_Files.push_back({ sourceFile, path, size, {} });
+}
+
+void AssetPackBuilder::AddData(const std::string& packedPath, std::vector<char> contents)
+{
+	std::string path = packedPath;
+	std::replace(path.begin(), path.end(), '\\', '/');
+	const std::uintmax_t size = contents.size();
+	m_Files.push_back({ std::filesystem::path(), path, size, std::move(contents) });
+}
+
+bool AssetPackBuilder::BakeImage(const std::string& fileName, double& outDecodeMilliseconds)
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	sf::Image image;
+	if (!image.loadFromFile(fileName))
+	{
+		Log::Print("Cannot bake " + fileName, LogLevel::ERROR_);
+		return false;
+	}
+	outDecodeMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	// The game prefers the baked copy, the encoded file would never be read from the pack again
+	std::vector<char> contents;
+	BakedTexture::Encode(image, contents);
+	Remove(fileName);
+	AddData(BakedTexture::GetBakedPath(fileName), std::move(contents));
+	return true;
+}
+
+bool AssetPackBuilder::Write(const std::string& outputFile)
+{
+	SortAndDeduplicate();
+
+	std::uint32_t pathBytes = 0;
+	for (const PackedFile& file : m_Files)
+	{
+		pathBytes += static_cast<std::uint32_t>(file.path.size());
+	}
+
+	// Lay the files out first, the index in front needs their offsets
+	AssetPackHeader header = {};
+	std::copy(std::begin(AssetPack::MAGIC), std::end(AssetPack::MAGIC), header.magic);
+	header.version = AssetPack::VERSION;
+	header.entryCount = static_cast<std::uint32_t>(m_Files.size());
+	header.pathBytes = pathBytes;
+
+	std::vector<AssetPackEntry> entries(m_Files.size());
+	std::uint64_t offset = sizeof(AssetPackHeader) + entries.size() * sizeof(AssetPackEntry) + pathBytes;
+	std::uint32_t pathOffset = 0;
+	for (std::size_t i = 0; i < m_Files.size(); ++i)
+	{
+		offset = AlignOffset(offset);
+		entries[i].dataOffset = offset;
+		entries[i].dataSize = m_Files[i].size;
+		entries[i].pathOffset = pathOffset;
+		entries[i].pathLength = static_cast<std::uint32_t>(m_Files[i].path.size());
+
+		offset += m_Files[i].size;
+		pathOffset += entries[i].pathLength;
+	}
+
+	std::ofstream pack(outputFile, std::ios::binary | std::ios::trunc);
+	if (!pack)
+	{
+		Log::Print("Cannot create " + outputFile, LogLevel::ERROR_);
+		return false;
+	}
+
+	pack.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	pack.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(AssetPackEntry)));
+	for (const PackedFile& file : m_Files)
+	{
+		pack.write(file.path.data(), static_cast<std::streamsize>(file.path.size()));
+	}
+
+	std::uint64_t position = sizeof(AssetPackHeader) + entries.size() * sizeof(AssetPackEntry) + pathBytes;
+	std::vector<char> buffer;
+	for (std::size_t i = 0; i < m_Files.size(); ++i)
+	{
+		const std::vector<char>* contents = &m_Files[i].contents;
+		if (!m_Files[i].source.empty())
+		{
+			std::ifstream source(m_Files[i].source, std::ios::binary);
+			buffer.resize(static_cast<std::size_t>(m_Files[i].size));
+			if (!source.read(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+			{
+				Log::Print("Cannot read " + m_Files[i].source.generic_string(), LogLevel::ERROR_);
+				return false;
+			}
+			contents = &buffer;
+		}
+
+		PadTo(pack, position, entries[i].dataOffset);
+		pack.write(contents->data(), static_cast<std::streamsize>(contents->size()));
+		position += contents->size();
+	}
+
+	if (!pack)
+	{
+		Log::Print("Failed to write " + outputFile, LogLevel::ERROR_);
+		return false;
+	}
+	return true;
+}
+
+std::uintmax_t AssetPackBuilder::GetContentBytes() const
+{
+	std::uintmax_t bytes = 0;
+	for (const PackedFile& file : m_Files)
+	{
+		bytes += file.size;
+	}
+	return bytes;
+}
+
+void AssetPackBuilder::SortAndDeduplicate()
+{
+	std::sort(m_Files.begin(), m_Files.end(),
+		[](const PackedFile& left, const PackedFile& right) { return AssetPack::ComparePaths(left.path, right.path) < 0; });
+
+	// The game looks paths up case-insensitively, two files it cannot tell apart would make lookups ambiguous
+	auto duplicate = std::unique(m_Files.begin(), m_Files.end(),
+		[](const PackedFile& left, const PackedFile& right)
+		{
+			if (AssetPack::ComparePaths(left.path, right.path) != 0)
+			{
+				return false;
+			}
+			Log::Print("Only packing the first of two files named", right.path, LogLevel::WARNING);
+			return true;
+		});
+	m_Files.erase(duplicate, m_Files.end());
+}
+
+void AssetPackBuilder::Remove(const std::string& packedPath)
+{
+	m_Files.erase(std::remove_if(m_Files.begin(), m_Files.end(),
+		[&packedPath](const PackedFile& file) { return AssetPack::ComparePaths(file.path, packedPath) == 0; }), m_Files.end());
+}
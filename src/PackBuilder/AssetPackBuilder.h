@@ -0,0 +1,110 @@
+/*!
+ * \file AssetPackBuilder.h
+ *
+ * \brief Contains the AssetPackBuilder class, which writes the packs the game's AssetPack maps.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
+#pragma once
+#include <filesystem>
+
+/**
+ * @class AssetPackBuilder
+ * @brief Collects files and writes them into one pack, in the layout described in AssetPack.h.
+ *
+ * Typical usage:
+ * - AddDirectory() for the resource tree, skipping directories that do not ship
+ * - BakeImage() for the large images, replacing their PNG with raw pixels
+ * - Write() the pack
+ */
+class AssetPackBuilder
+{
+public:
+	/**
+	 * @brief Adds every file below a directory, stored under its path relative to the working directory.
+	 *
+	 * @param directory The directory to pack, e.g. "resources".
+	 * @param excludedDirectories Names of directories to skip wherever they appear, e.g. "inspiration".
+	 * @return False if the directory could not be read.
+	 */
+	bool AddDirectory(const std::string& directory, const std::vector<std::string>& excludedDirectories);
+
+	/**
+	 * @brief Adds one file.
+	 *
+	 * @param sourceFile The file to read.
+	 * @param packedPath The path the game looks it up by.
+	 */
+	void AddFile(const std::filesystem::path& sourceFile, const std::string& packedPath);
+
+	/**
+	 * @brief Adds contents built in memory.
+	 *
+	 * @param packedPath The path the game looks them up by.
+	 * @param contents The bytes to store.
+	 */
+	void AddData(const std::string& packedPath, std::vector<char> contents);
+
+	/**
+	 * @brief Decodes an image and packs its BakedTexture in place of the encoded file.
+	 *
+	 * @param fileName The path of the image, as the game requests it.
+	 * @param outDecodeMilliseconds Receives the time the image took to decode, which the game no longer spends.
+	 * @return False if the image could not be decoded; the encoded file then stays in the pack.
+	 */
+	bool BakeImage(const std::string& fileName, double& outDecodeMilliseconds);
+
+	/**
+	 * @brief Writes the pack: header, sorted index, paths and the aligned file contents.
+	 *
+	 * @param outputFile The path of the pack.
+	 * @return True if every file was read and the pack was written.
+	 */
+	bool Write(const std::string& outputFile);
+
+	// Getters
+
+	/**
+	 * @brief Gets the number of files added.
+	 *
+	 * @return The file count.
+	 */
+	inline std::size_t GetFileCount() const { return m_Files.size(); }
+
+	/**
+	 * @brief Gets the total size of the files added.
+	 *
+	 * @return The size in bytes, without the index.
+	 */
+	std::uintmax_t GetContentBytes() const;
+
+private:
+	/**
+	 * @struct PackedFile
+	 * @brief A file waiting to be written.
+	 */
+	struct PackedFile
+	{
+		std::filesystem::path source; ///< The file on disk, empty for contents built in memory
+		std::string path;             ///< The path it is stored under, with forward slashes
+		std::uintmax_t size = 0;      ///< Its size, in bytes
+		std::vector<char> contents;   ///< The contents when there is no source file
+	};
+
+	/**
+	 * @brief Sorts the files in index order and drops paths that only differ by case or slashes.
+	 */
+	void SortAndDeduplicate();
+
+	/**
+	 * @brief Removes a file added before.
+	 *
+	 * @param packedPath The path it is stored under; case and slash direction do not matter.
+	 */
+	void Remove(const std::string& packedPath);
+
+private:
+	std::vector<PackedFile> m_Files; ///< Everything added so far
+};
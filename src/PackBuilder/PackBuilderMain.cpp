@@ -0,0 +1,91 @@
+#include "stdafx.h"
+#include "AssetPackBuilder.h"
+#include "Core/Utility/Strings.h"
+
+// ********************* PACK BUILDER DEFAULTS ********************
+constexpr const char* DEFAULT_RESOURCE_DIRECTORY = "resources";
+const std::vector<std::string> DEFAULT_EXCLUDED_DIRECTORIES = { "inspiration" }; // Reference art, never loaded by the game
+const std::vector<std::string> DEFAULT_BAKED_IMAGES = { GAME_BACKGROUND, MAIN_MENU_BACKGROUND }; // The 2 MB full-screen PNGs
+// ****************************************************
+
+/**
+ * @brief Entry point of the pack builder.
+ *
+ * Run from the directory the game runs from:
+ * PackBuilder [--exclude=name ...] [--bake=image ...] [resourceDirectory] [outputFile]
+ * Without arguments, packs resources/ without its inspiration/ art into ASSET_PACK, with the two backgrounds baked.
+ * --bake adds an image to store as raw pixels (see BakedTexture.h); the time its PNG took to decode is printed.
+ *
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments.
+ * @return 0 if the pack was written.
+ */
+int main(int argc, char** argv)
+{
+	std::string resourceDirectory = DEFAULT_RESOURCE_DIRECTORY;
+	std::string outputFile = ASSET_PACK;
+	std::vector<std::string> excludedDirectories = DEFAULT_EXCLUDED_DIRECTORIES;
+	std::vector<std::string> bakedImages = DEFAULT_BAKED_IMAGES;
+
+	// Options may come anywhere, the remaining arguments are positional
+	const std::string excludeOption = "--exclude=";
+	const std::string bakeOption = "--bake=";
+	std::vector<std::string> arguments;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument.rfind(excludeOption, 0) == 0)
+		{
+			excludedDirectories.push_back(argument.substr(excludeOption.size()));
+		}
+		else if (argument.rfind(bakeOption, 0) == 0)
+		{
+			bakedImages.push_back(argument.substr(bakeOption.size()));
+		}
+		else
+		{
+			arguments.push_back(argument);
+		}
+	}
+
+	if (arguments.size() > 2)
+	{
+		std::cerr << "Usage: PackBuilder [--exclude=name ...] [--bake=image ...] [resourceDirectory] [outputFile]" << std::endl;
+		return 1;
+	}
+	if (!arguments.empty())
+	{
+		resourceDirectory = arguments[0];
+	}
+	if (arguments.size() > 1)
+	{
+		outputFile = arguments[1];
+	}
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	AssetPackBuilder builder;
+	if (!builder.AddDirectory(resourceDirectory, excludedDirectories))
+	{
+		return 1;
+	}
+
+	for (const std::string& image : bakedImages)
+	{
+		double decodeMilliseconds = 0.0;
+		if (builder.BakeImage(image, decodeMilliseconds))
+		{
+			std::cout << "Baked " << image << ", its PNG took " << decodeMilliseconds << " ms to decode" << std::endl;
+		}
+	}
+
+	if (!builder.Write(outputFile))
+	{
+		return 1;
+	}
+
+	const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << "Packed " << builder.GetFileCount() << " files (" << builder.GetContentBytes() / 1024 << " KiB) into "
+		<< outputFile << " in " << elapsed.count() << " ms" << std::endl;
+	return 0;
+}
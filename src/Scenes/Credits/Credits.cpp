@@ -2,6 +2,9 @@
 #include "Credits.h"
 #include "Core/Utility/Strings.h"
 #include "Core/Utility/Helper.h"
+#include "Core/Managers/ResourceCache.h"
+#include "Core/Managers/InputManager.h"
+#include "Core/Rendering/RenderSnapshot.h"
 
 Credits::Credits(SceneManager& sceneManager, sf::RenderWindow& window)
 	: m_SceneManager(sceneManager), m_Window(window)
@@ -10,7 +13,8 @@ Credits::Credits(SceneManager& sceneManager, sf::RenderWindow& window)
 	CoreHelper::LoadTextureAndSprite(m_CursorTexture, m_CursorSprite, CURSOR);
 
 	// Load your font  make sure this path is correct for your project
-	if (!m_Font.loadFromFile(FONT_C))
+	m_Font = ResourceCache::Get().GetFont(FONT_C);
+	if (m_Font == nullptr)
 	{
 		throw std::runtime_error("Failed to load font!");
 	}
@@ -30,7 +34,7 @@ Credits::Credits(SceneManager& sceneManager, sf::RenderWindow& window)
 	for (size_t i = 0; i < entries.size(); ++i)
 	{
 		sf::Text text;
-		text.setFont(m_Font);
+		text.setFont(*m_Font);
 		text.setString(entries[i]);
 		text.setCharacterSize(28);
 		text.setFillColor(sf::Color::White);
@@ -49,7 +53,7 @@ Credits::Credits(SceneManager& sceneManager, sf::RenderWindow& window)
 	m_BackButton.setOutlineThickness(2.f);
 	m_BackButton.setPosition(20.f, m_Window.getSize().y - 70.f);
 
-	m_BackText.setFont(m_Font);
+	m_BackText.setFont(*m_Font);
 	m_BackText.setString("Back");
 	m_BackText.setCharacterSize(20);
 	m_BackText.setFillColor(sf::Color::White);
@@ -67,10 +71,10 @@ void Credits::Update(float deltaTime)
 {
 	UpdateCursor();
 
-	// Handle mouse click
-	if (sf::Mouse::isButtonPressed(sf::Mouse::Left))
+	// Handle mouse click, through the InputManager so recorded sessions can leave the credits too
+	if (InputManager::Get().IsKeyPress(KeyBind::Shoot))
 	{
-		sf::Vector2f mousePos = (sf::Vector2f)sf::Mouse::getPosition(m_Window);
+		sf::Vector2f mousePos = (sf::Vector2f)m_MousePos;
 
 		if (m_BackButton.getGlobalBounds().contains(mousePos))
 		{
@@ -79,28 +83,30 @@ void Credits::Update(float deltaTime)
 	}
 
 	// Optional: Escape key fallback
-	if (sf::Keyboard::isKeyPressed(sf::Keyboard::Escape))
+	if (InputManager::Get().IsKeyPress(KeyBind::Pause))
 	{
 		m_SceneManager.Switch(SceneID::MAIN_MENU);
 	}
+
+	InputManager::Get().Update(deltaTime);
 }
 
-void Credits::Draw()
+void Credits::Draw(RenderSnapshot& snapshot, float alpha)
 {
 	for (const auto& text : m_CreditTexts)
 	{
-		m_Window.draw(text);
+		snapshot.Draw(text);
 	}
 	// Draw Back button
-	m_Window.draw(m_BackButton);
-	m_Window.draw(m_BackText);
-	m_Window.draw(m_CursorSprite);
+	snapshot.Draw(m_BackButton);
+	snapshot.Draw(m_BackText);
+	snapshot.Draw(m_CursorSprite);
 }
 
 void Credits::UpdateCursor()
 {
-	// Get mouse position relative to the window
-	m_MousePos = sf::Mouse::getPosition(m_Window); // Pass the window object here
+	// Cursor position of the tick, live or replayed
+	m_MousePos = InputManager::Get().GetCursorPosition();
 
 	// Update the cursor position
 	m_CursorSprite.setPosition(static_cast<float>(m_MousePos.x), static_cast<float>(m_MousePos.y));
@@ -5,7 +5,7 @@ class Credits : public IGameScene
 public:
 	Credits(SceneManager& sceneManager, sf::RenderWindow& window);
 	void Update(float deltaTime) override;
-	void Draw() override;
+	void Draw(RenderSnapshot& snapshot, float alpha) override;
 
 private:
 	void UpdateCursor();
@@ -14,11 +14,11 @@ private:
 	SceneManager& m_SceneManager;
 	sf::RenderWindow& m_Window;
 
-	sf::Texture m_CursorTexture;
+	std::shared_ptr<sf::Texture> m_CursorTexture;
 	sf::Sprite m_CursorSprite;
 	sf::Vector2i m_MousePos;
 
-	sf::Font m_Font;
+	std::shared_ptr<sf::Font> m_Font;
 	std::vector<sf::Text> m_CreditTexts;
 
 	sf::RectangleShape m_BackButton;
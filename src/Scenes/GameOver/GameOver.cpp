@@ -1,7 +1,9 @@
 #include "stdafx.h"
 #include "GameOver.h"
-#include "Core/Utility/strings.h"
+#include "Core/Utility/Strings.h"
 #include "Core/Managers/InputManager.h"
+#include "Core/Managers/ResourceCache.h"
+#include "Core/Rendering/RenderSnapshot.h"
 
 GameOver::GameOver(SceneManager& stateManager, sf::RenderWindow& window)
 	: m_StateManager(stateManager)
@@ -15,9 +17,14 @@ void GameOver::OnInit()
 {
 	m_Timer.SetInterval(5.0f);
 
-	m_Font.loadFromFile(FONT_A);
+	m_Font = ResourceCache::Get().GetFont(FONT_A);
+	if (m_Font == nullptr)
+	{
+		Log::Print("Error loading font!", LogLevel::ERROR_);
+		return;
+	}
 
-	m_GameOverText.setFont(m_Font);
+	m_GameOverText.setFont(*m_Font);
 	m_GameOverText.setString("You have lost all your lives!");
 	m_GameOverText.setOutlineColor(sf::Color::Blue);
 	m_GameOverText.setCharacterSize(64); // Adjust as needed
@@ -27,12 +34,8 @@ void GameOver::OnInit()
 	sf::FloatRect textRect = m_GameOverText.getLocalBounds();
 	m_GameOverText.setOrigin(textRect.left + textRect.width / 2.0f, textRect.top + textRect.height / 2.0f);
 
-	m_TimeToRestart.setFont(m_Font);
-	m_TimeToRestart.setCharacterSize(22);
-	m_TimeToRestart.setOutlineColor(sf::Color::Blue);
-	m_TimeToRestart.setOutlineThickness(1.2f);
-	m_TimeToRestart.setFillColor(sf::Color::White);
-	m_TimeToRestart.setPosition(0, 0);
+	m_TimeToRestart.Init(*m_Font, 22, sf::Vector2f(0, 0));
+	m_TimeToRestart.SetLabel("Restarting in ");
 }
 
 void GameOver::OnDestroy()
@@ -40,6 +43,12 @@ void GameOver::OnDestroy()
 
 }
 
+void GameOver::ResetState()
+{
+	// Drop the time left over from the previous game over
+	m_Timer.Restart();
+}
+
 void GameOver::OnStart()
 {
 
@@ -57,19 +66,19 @@ void GameOver::Update(float deltaTime)
 		m_StateManager.Switch(SceneID::CREDITS);
 	}
 
-
-	std::string timeLeftToRestartText = "Restarting in " + std::to_string(static_cast<int>(m_IntervalToRestartInSeconds - m_Timer.GetPassedTime()));
-	m_TimeToRestart.setString(timeLeftToRestartText);
+	// The countdown only changes once per second, the text is rebuilt then and not every tick
+	const int secondsLeft = static_cast<int>(m_IntervalToRestartInSeconds - m_Timer.GetPassedTime());
+	m_TimeToRestart.SetValue(secondsLeft);
 
 	// Position it in the center every frame in case the window resizes
 	m_GameOverText.setPosition(m_Window.getSize().x / 2.0f, m_Window.getSize().y / 2.0f);
 
 }
 
-void GameOver::Draw()
+void GameOver::Draw(RenderSnapshot& snapshot, float alpha)
 {
-	m_Window.draw(m_GameOverText);
-	m_Window.draw(m_TimeToRestart);
+	snapshot.Draw(m_GameOverText);
+	m_TimeToRestart.Draw(snapshot);
 }
 
 void GameOver::HandleInput(float deltaTime)
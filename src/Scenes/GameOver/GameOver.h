@@ -12,6 +12,7 @@
  */
 
 #pragma once
+#include "Core/Rendering/HudText.h"
 
  /**
   * @class GameOver
@@ -46,6 +47,11 @@ public:
      */
     void OnDestroy() override;
 
+    /**
+     * @brief Restarts the countdown, so every game over waits the full interval.
+     */
+    void ResetState() override;
+
     /**
      * @brief Starts the game over scene.
      *
@@ -70,11 +76,14 @@ public:
     void Update(float deltaTime) override;
 
     /**
-     * @brief Draws the game over scene to the window.
+     * @brief Records the game over scene into the frame's snapshot.
      *
      * This function renders the game over screen, including the game over text and instructions for restarting.
+     *
+     * @param snapshot The frame being recorded.
+     * @param alpha The interpolation factor between simulation ticks (unused, the screen has no moving objects).
      */
-    void Draw() override;
+    void Draw(RenderSnapshot& snapshot, float alpha) override;
 
     /**
      * @brief Handles user input during the game over scene.
@@ -94,9 +103,9 @@ private:
     sf::RenderWindow& m_Window;  ///< The render window to display the game over scene
 
     // Text and Font for the Game Over screen
-    sf::Font m_Font;  ///< The font used for displaying text on the game over screen
+    std::shared_ptr<sf::Font> m_Font;  ///< The shared font used for displaying text on the game over screen
     sf::Text m_GameOverText;  ///< The text object that displays the "Game Over" message
-    sf::Text m_TimeToRestart;  ///< The text object that displays the restart countdown message
+    HudText m_TimeToRestart;  ///< The text object that displays the restart countdown message
 
     // Timer for handling the restart interval
     Timer m_Timer;  ///< The timer that tracks the time remaining before the game restarts
@@ -3,32 +3,69 @@
 #include "LevelOne.h"
 #include "Core/Utility/GameplayUtility.h"
 #include "Core/Utility/Helper.h"
-#include "Core/Utility/strings.h"
+#include "Core/Utility/Strings.h"
+#include "Core/Managers/ResourceCache.h"
+#include "Core/Rendering/RenderSnapshot.h"
+#include "Core/Managers/GameEventQueue.h"
 
 // ********************* LEVEL ONE CONSTANTS ********************
 constexpr int MAX_COWS = 45;
 constexpr int ENEMIES_ON_ROW = 15;
-constexpr int ENEMIES_ON_COLUMN = 15;
 constexpr int ENEMIES_SPACING_X = 130;
 constexpr int ENEMIES_SPACING_Y = 150;
 constexpr int LEVEL = 1;
+constexpr float BACKGROUND_SCROLL_SPEED = 300.0f; // Pixels per second the background moves down
+// ****************************************************
+
+// ********************* WAVE BANNER CONSTANTS ********************
+constexpr float WAVE_BANNER_DURATION = 2.0f;  // Seconds a "Wave N" banner stays on screen
+constexpr float WAVE_BANNER_SCALE = 4.0f;     // The banners are 64x32 pixel art
+constexpr float WAVE_BANNER_Y = 300.0f;
 // ****************************************************
 
 LevelOne::LevelOne(SceneManager& sceneManager, sf::RenderWindow& window)
 	: m_SceneManager(sceneManager)
 	, m_Window(window)
+	, m_Enemies(EGG)
+	, m_WaveBannerTimeLeft(0.0f)
 	, m_Lives(3)
 	, m_IsGamePaused(false)
 {
+	// Seeded from the session so a replayed recording meets the same enemy decisions
+	m_Enemies.Seed(InputManager::Get().GetSessionSeed());
+
+	// Every asset the level needs is acquired here once, restarting the level only resets its state
 	InitBackground();
 	InitLevelText();
+	InitWaves();
 	CoreHelper::LoadMusic(m_BackgroundMusic, GAME_MUSIC);
 	CoreHelper::LoadMusic(m_GameOver, GAME_OVER_MUSIC);
+	m_BackgroundMusic.setLoop(true);
+}
+
+void LevelOne::ResetState()
+{
+	MOO_PROFILE_FUNCTION();
+	m_Lives = 3;
+	m_IsGamePaused = false;
+
+	// Clear previous game state, including events of the last run nobody consumed yet
+	GameEventQueue::Get().Clear();
+	m_Enemies.Clear();
+	m_Spaceship.Reset();
+
+	// Restart the waves, the first one streams in from the next tick
+	m_WaveDirector.Start(m_Enemies);
+	m_WaveBannerTimeLeft = 0.0f;
+
+	// Scroll the background back to its start
+	m_Background.Reset();
 }
 
 void LevelOne::OnStart()
 {
-	Reset();
+	// Restart music
+	m_BackgroundMusic.play();
 }
 
 void LevelOne::OnStop()
@@ -38,10 +75,12 @@ void LevelOne::OnStop()
 
 void LevelOne::Update(float deltaTime)
 {
+	MOO_PROFILE_FUNCTION();
 	if (!m_IsGamePaused)
 	{
-		UpdateBackground(deltaTime);
+		m_Background.Update(deltaTime);
 		UpdateSpaceship(deltaTime);
+		UpdateWaves(deltaTime);
 		UpdateEnemies(deltaTime);
 		UpdateLevelText();
 		CheckAndResolveCollisions();
@@ -49,17 +88,25 @@ void LevelOne::Update(float deltaTime)
 	}
 }
 
-void LevelOne::Draw()
+void LevelOne::Draw(RenderSnapshot& snapshot, float alpha)
 {
-	DrawBackgrounds();
-	DrawTexts();
-	DrawSpaceship();
-	DrawEnemies();
+	MOO_PROFILE_FUNCTION();
+	DrawBackground(snapshot, alpha);
+	DrawTexts(snapshot);
+
+	// Every entity goes through the batch, drawn with one call per texture
+	m_SpriteBatch.Begin();
+	DrawSpaceship(alpha);
+	DrawEnemies(alpha);
+
+	MOO_PROFILE_SCOPE("SubmitSpriteBatch");
+	m_SpriteBatch.End(snapshot);
 }
 
 
 void LevelOne::HandleInput(float deltaTime)
 {
+	MOO_PROFILE_FUNCTION();
 	if (InputManager::Get().IsKeyPress(KeyBind::Pause) && !m_IsGamePaused)
 	{
 		m_IsGamePaused = true; 
@@ -72,152 +119,157 @@ void LevelOne::HandleInput(float deltaTime)
 	InputManager::Get().Update(deltaTime);
 }
 
+void LevelOne::CollectStats(SceneStats& outStats) const
+{
+	outStats.enemies = m_Enemies.Size();
+	outStats.enemyProjectiles = m_Enemies.GetProjectiles().Size();
+	outStats.playerProjectiles = m_Spaceship.GetProjectiles().Size();
+	outStats.batchedSprites = m_SpriteBatch.GetSpriteCount();
+	outStats.drawCallsSaved = m_SpriteBatch.GetDrawCallsSaved();
+}
+
 void LevelOne::InitBackground()
 {
-	CoreHelper::LoadTextureAndSprite(m_BackgroundTexture, m_BackgroundSprite, GAME_BACKGROUND);
-	CoreHelper::LoadTextureAndSprite(m_BackgroundTexture, m_BackgroundSpriteTwo, GAME_BACKGROUND);
-	const float height = static_cast<float>(m_BackgroundTexture.getSize().y);
-	m_BackgroundSprite.setPosition(0.f, 0.f);
-	m_BackgroundSpriteTwo.setPosition(0.f, +height); // Make sure this is ABOVE the first
+	m_Background.SetViewSize(sf::Vector2f(m_Window.getSize()));
+	m_Background.AddLayer(GAME_BACKGROUND, BACKGROUND_SCROLL_SPEED);
 }
 
 void LevelOne::InitLevelText()
 {
 	// Load font
-	if (!m_Font.loadFromFile(FONT_A))  // Make sure to replace with the correct path
+	m_Font = ResourceCache::Get().GetFont(FONT_A);
+	if (m_Font == nullptr)
 	{
 		Log::Print("Error loading font!", LogLevel::ERROR_);
 		return;
 	}
 
-	// Initialize Level Text
-	m_LevelText.setFont(m_Font);
-	m_LevelText.setCharacterSize(24);  // Set the font size
-	m_LevelText.setFillColor(sf::Color::White);
-	m_LevelText.setPosition(10.f, 10.f);  // Position at top-left corner
-	m_LevelText.setOutlineThickness(1.2f);
-	m_LevelText.setOutlineColor(sf::Color::Blue);
-
-	// Initialize Lives Text
-	m_LivesText.setFont(m_Font);
-	m_LivesText.setCharacterSize(24);  // Set the font size
-	m_LivesText.setFillColor(sf::Color::White);
-	m_LivesText.setPosition(10.f, 40.f);  // Position below level text
-	m_LivesText.setOutlineThickness(1.2f);
-	m_LivesText.setOutlineColor(sf::Color::Blue);
-
-	// Initialize Pause Text
-	m_PausedText.setFont(m_Font);
-	m_PausedText.setCharacterSize(50);  // Set the font size
-	m_PausedText.setFillColor(sf::Color::White);
-	// First, set the origin to the center of the text
-	m_PausedText.setOrigin(
-		m_PausedText.getLocalBounds().width * 0.5f,
-		m_PausedText.getLocalBounds().height * 0.5f
-	);
-
-	// Then, set the position to the center of the window
-	m_PausedText.setPosition(
-		sf::Vector2f(
-			static_cast<float>(m_Window.getSize().x * 0.4f),
-			static_cast<float>(m_Window.getSize().y * 0.4f)
-		));
-	m_PausedText.setOutlineThickness(1.2f);
-	m_PausedText.setOutlineColor(sf::Color::Blue);
-	m_PausedText.setString("GAME PAUSE");
+	// Initialize Level Text, at the top-left corner; the level never changes
+	m_LevelText.Init(*m_Font, 24, sf::Vector2f(10.f, 10.f));
+	m_LevelText.SetLabel("Level: ");
+	m_LevelText.SetValue(LEVEL);
+
+	// Initialize Lives Text, below the level text; UpdateLevelText() shows the lives
+	m_LivesText.Init(*m_Font, 24, sf::Vector2f(10.f, 40.f));
+	m_LivesText.SetLabel("Lives: ");
+
+	// Initialize Pause Text, towards the center of the window
+	const sf::Vector2f pausePosition(m_Window.getSize().x * 0.4f, m_Window.getSize().y * 0.4f);
+	m_PausedText.Init(*m_Font, 50, pausePosition);
+	m_PausedText.SetString("GAME PAUSE");
 }
 
-void LevelOne::UpdateBackground(float deltaTime)
+void LevelOne::UpdateSpaceship(float deltaTime)
 {
-	float scrollSpeed = 300.0f;
-	float moveY = scrollSpeed * deltaTime;
-
-	m_BackgroundSprite.move(0.0f, moveY);
-	m_BackgroundSpriteTwo.move(0.0f, moveY);
+	MOO_PROFILE_FUNCTION();
+	m_Spaceship.Update(InputManager::Get().GetCursorPosition(), m_Enemies, deltaTime);
+}
 
-	float height = static_cast<float>(m_BackgroundTexture.getSize().y);
+void LevelOne::UpdateEnemies(float deltaTime)
+{
+	MOO_PROFILE_FUNCTION();
+	m_Enemies.Update(deltaTime);
+}
 
-	// If a sprite moved completely off screen (above), reposition it below the other
-	if (m_BackgroundSprite.getPosition().y >= height)
+void LevelOne::InitWaves()
+{
+	std::vector<WaveDefinition> waves;
+	if (!WaveLoader::LoadFromFile(LEVEL_ONE_WAVES, waves))
 	{
-		m_BackgroundSprite.setPosition(0.f, m_BackgroundSpriteTwo.getPosition().y - height);
+		// Keep the level playable with the formation it always had
+		WaveDefinition wave;
+		wave.enemyType = EnemyType::PIG;
+		wave.count = MAX_COWS;
+		wave.difficulty = DifficultyLevel::VERY_EASY;
+		wave.columns = ENEMIES_ON_ROW;
+		wave.spacing = Vector2f(ENEMIES_SPACING_X, ENEMIES_SPACING_Y);
+		waves.push_back(wave);
 	}
 
-	if (m_BackgroundSpriteTwo.getPosition().y >= height)
-	{
-		m_BackgroundSpriteTwo.setPosition(0.f, m_BackgroundSprite.getPosition().y - height);
-	}
+	m_WaveDirector.SetWaves(waves);
 }
 
-void LevelOne::UpdateSpaceship(float deltaTime)
+void LevelOne::UpdateWaves(float deltaTime)
 {
-	m_Spaceship.Update(m_Window, m_Enemies, deltaTime);
-}
+	MOO_PROFILE_FUNCTION();
+	m_WaveDirector.Update(deltaTime, m_Enemies);
 
-void LevelOne::UpdateEnemies(float deltaTime)
-{
-	for (const auto& enemy : m_Enemies)
+	if (m_WaveDirector.HasWaveStarted() && m_WaveDirector.GetWaveNumber() <= WAVE_BANNER_COUNT)
 	{
-		if (enemy->IsAlive())
-		{
-			enemy->Update(deltaTime);
-		}
+		// The banners are packed in the atlas, looking one up does not touch the disk
+		CoreHelper::LoadTextureAndSprite(m_WaveBannerTexture, m_WaveBanner, CoreHelper::GetWaveBannerPath(m_WaveDirector.GetWaveNumber()));
+		m_WaveBanner.setScale(WAVE_BANNER_SCALE, WAVE_BANNER_SCALE);
+		m_WaveBanner.setPosition((m_Window.getSize().x - m_WaveBanner.getGlobalBounds().width) / 2.0f, WAVE_BANNER_Y);
+		m_WaveBannerTimeLeft = WAVE_BANNER_DURATION;
+	}
+	else
+	{
+		m_WaveBannerTimeLeft = std::max(0.0f, m_WaveBannerTimeLeft - deltaTime);
 	}
 }
 
 void LevelOne::UpdateLevelText()
 {
-	// Update level and lives texts based on current game state
-	m_LevelText.setString("Level: " + std::to_string(LEVEL));
-	m_LivesText.setString("Lives: " + std::to_string(m_Lives));
+	MOO_PROFILE_FUNCTION();
+	// The text is only rebuilt when the lives changed
+	m_LivesText.SetValue(m_Lives);
 	
-	// If there are no more enemies, SWITCH TO LEVEL 2 OR CREDITS
-	if (m_Enemies.empty())
+	// Once every wave is cleared, SWITCH TO LEVEL 2 OR CREDITS
+	if (m_WaveDirector.IsFinished())
 	{
 		m_SceneManager.Switch(SceneID::CREDITS);
 	}
 }
 
-void LevelOne::DrawBackgrounds()
+void LevelOne::DrawBackground(RenderSnapshot& snapshot, float alpha)
 {
-	m_Window.draw(m_BackgroundSprite);
-	m_Window.draw(m_BackgroundSpriteTwo);
-
+	MOO_PROFILE_FUNCTION();
+	m_Background.Draw(snapshot, alpha);
 }
 
 
-void LevelOne::DrawSpaceship()
+void LevelOne::DrawSpaceship(float alpha)
 {
-	m_Spaceship.Draw(m_Window);
+	MOO_PROFILE_FUNCTION();
+	m_Spaceship.Draw(m_SpriteBatch, alpha);
 }
 
 
-void LevelOne::DrawEnemies()
+void LevelOne::DrawEnemies(float alpha)
 {
-	for (const auto& enemy : m_Enemies)
-	{
-		enemy->Draw(m_Window);
-	}
+	MOO_PROFILE_FUNCTION();
+	m_Enemies.Draw(m_SpriteBatch, alpha);
 }
 
 
-void LevelOne::DrawTexts()
+void LevelOne::DrawTexts(RenderSnapshot& snapshot)
 {
+	MOO_PROFILE_FUNCTION();
+	if (m_Font == nullptr)
+	{
+		return;
+	}
+
 	if (m_IsGamePaused)
 	{
-		m_Window.draw(m_PausedText);
+		m_PausedText.Draw(snapshot);
 	}
 
-	// Draw UI text (level and lives)
-	m_Window.draw(m_LevelText);
-	m_Window.draw(m_LivesText);
+	if (m_WaveBannerTimeLeft > 0.0f && m_WaveBannerTexture != nullptr)
+	{
+		snapshot.Draw(m_WaveBanner);
+	}
 
+	// Draw UI text (level and lives)
+	m_LevelText.Draw(snapshot);
+	m_LivesText.Draw(snapshot);
 
 }
 
 void LevelOne::CheckAndResolveCollisions()
 {
-	GameplayUtility::CheckEnemyCollision(m_Enemies, m_Spaceship.GetProjectiles());
+	MOO_PROFILE_FUNCTION();
+	GameplayUtility::CheckEnemyCollision(m_Enemies, m_Spaceship.GetProjectiles(), m_EnemyGrid);
 
 	if (GameplayUtility::HasEnemyProjectileHitSpaceship(m_Enemies, m_Spaceship))
 	{
@@ -240,22 +292,3 @@ void LevelOne::OnGameOver()
 	m_GameOver.play();
 	m_SceneManager.Switch(SceneID::GAME_OVER);
 }
-
-void LevelOne::Reset()
-{
-	m_Lives = 3;
-	// Clear previous game state
-	m_Enemies.clear();
-	m_Spaceship.Reset();
-	m_BackgroundMusic.stop();
-
-	// Reinitialize enemies
-	GameplayUtility::EnemySpawner(m_Enemies, PIG, EGG, DifficultyLevel::VERY_EASY, m_RNG, MAX_COWS, ENEMIES_ON_ROW, ENEMIES_ON_COLUMN, ENEMIES_SPACING_X, ENEMIES_SPACING_Y);
-
-	// Reinitialize background
-	InitBackground();
-
-	// Restart music
-	m_BackgroundMusic.setLoop(true);
-	m_BackgroundMusic.play();
-}
\ No newline at end of file
@@ -13,7 +13,12 @@
 
 #pragma once
 #include "Entities/Spaceship.h"
-#include "Entities/Enemy.h"
+#include "Entities/EnemyStore.h"
+#include "Core/Utility/SpatialHashGrid.h"
+#include "Core/Gameplay/WaveDirector.h"
+#include "Core/Rendering/SpriteBatch.h"
+#include "Core/Rendering/ParallaxBackground.h"
+#include "Core/Rendering/HudText.h"
 
  /**
   * @class LevelOne
@@ -49,10 +54,18 @@ public:
     void OnDestroy() override {};
 
     /**
-     * @brief Starts the level scene, preparing necessary resources.
+     * @brief Resets the level for a new playthrough.
+     *
+     * Puts the lives, the spaceship, the enemies, the waves and the background scroll back to their initial state.
+     * The textures, font and music acquired by the constructor are kept, so a restart loads nothing.
+     */
+    void ResetState() override;
+
+    /**
+     * @brief Starts the level scene.
      *
-     * This function is called when the level is initialized. It sets up the level-specific resources like background
-     * music and text.
+     * This function is called every time the level becomes active, after ResetState(). It restarts the background
+     * music.
      */
     void OnStart() override;
 
@@ -75,11 +88,15 @@ public:
     void Update(float deltaTime) override;
 
     /**
-     * @brief Draws the level scene to the window.
+     * @brief Records the level scene into the frame's snapshot.
      *
      * This function renders the background, spaceship, enemies, and UI elements to the window.
+     * Enemies and projectiles are drawn between their last two simulated positions.
+     *
+     * @param snapshot The frame being recorded.
+     * @param alpha How far the frame is between the previous tick (0) and the current tick (1).
      */
-    void Draw() override;
+    void Draw(RenderSnapshot& snapshot, float alpha) override;
 
     /**
      * @brief Handles input events for the level scene.
@@ -91,11 +108,18 @@ public:
      */
     void HandleInput(float deltaTime) override;
 
+    /**
+     * @brief Reports the enemies and the projectiles of both sides currently alive.
+     *
+     * @param outStats Receives the counts.
+     */
+    void CollectStats(SceneStats& outStats) const override;
+
 private:
     /**
      * @brief Initializes the background for the level.
      *
-     * This function sets up the background textures and positions for the level.
+     * This function sets up the scrolling background layers over the whole window.
      */
     void InitBackground();
 
@@ -106,15 +130,6 @@ private:
      */
     void InitLevelText();
 
-    /**
-     * @brief Updates the background, including parallax effects if applicable.
-     *
-     * This function is called every frame to update the background's position and other related effects.
-     *
-     * @param deltaTime The time elapsed since the last frame (in seconds)
-     */
-    void UpdateBackground(float deltaTime);
-
     /**
      * @brief Updates the spaceship position and actions.
      *
@@ -134,29 +149,50 @@ private:
     void UpdateEnemies(float deltaTime);
 
     /**
-     * @brief Updates the level-related UI text, such as level name and lives count.
+     * @brief Loads the level's waves, falling back to the original single wave if the wave file is unusable.
+     */
+    void InitWaves();
+
+    /**
+     * @brief Streams in the current wave's enemies and shows the banner of every new wave.
+     *
+     * @param deltaTime The time elapsed since the last frame (in seconds)
+     */
+    void UpdateWaves(float deltaTime);
+
+    /**
+     * @brief Updates the lives text when the lives changed, and leaves the level once its waves are over.
      */
     void UpdateLevelText();
 
     /**
-     * @brief Draws the background to the window.
+     * @brief Records the background layers.
+     *
+     * @param snapshot The frame being recorded.
+     * @param alpha The interpolation factor between the previous and the current tick.
      */
-    void DrawBackgrounds();
+    void DrawBackground(RenderSnapshot& snapshot, float alpha);
 
     /**
-     * @brief Draws the spaceship to the window.
+     * @brief Adds the spaceship to the sprite batch.
+     *
+     * @param alpha The interpolation factor between the previous and the current tick.
      */
-    void DrawSpaceship();
+    void DrawSpaceship(float alpha);
 
     /**
-     * @brief Draws the enemies to the window.
+     * @brief Adds the enemies to the sprite batch.
+     *
+     * @param alpha The interpolation factor between the previous and the current tick.
      */
-    void DrawEnemies();
+    void DrawEnemies(float alpha);
 
     /**
-     * @brief Draws the UI text elements (level, lives, paused text) to the window.
+     * @brief Records the UI text elements (level, lives, paused text).
+     *
+     * @param snapshot The frame being recorded.
      */
-    void DrawTexts();
+    void DrawTexts(RenderSnapshot& snapshot);
 
     /**
      * @brief Checks and resolves collisions between the spaceship and enemies.
@@ -179,13 +215,6 @@ private:
      */
     void OnGameOver();
 
-    /**
-     * @brief Resets the level for a new playthrough.
-     *
-     * This function resets the level's entities and variables to their initial state.
-     */
-    void Reset();
-
 private:
     // Window Renderer
     sf::RenderWindow& m_Window;  ///< The render window to display the level
@@ -195,24 +224,27 @@ private:
 
     // Objects
     Spaceship m_Spaceship;                  ///< The player's spaceship
-    std::vector<std::unique_ptr<Enemy>> m_Enemies;  ///< List of enemies in the level
+    EnemyStore m_Enemies;                   ///< Every enemy of the level and their projectiles
+    SpatialHashGrid m_EnemyGrid;            ///< Broadphase grid rebuilt from the enemies every tick
+    WaveDirector m_WaveDirector;            ///< Spawns the level's waves into m_Enemies over several ticks
+
+    // Rendering
+    SpriteBatch m_SpriteBatch;              ///< Batches the spaceship, enemies and projectiles into one draw call per texture
+    ParallaxBackground m_Background;        ///< Scrolling background, one repeated-texture quad per layer
 
     // Music
     sf::Music m_BackgroundMusic;  ///< Background music for the level
     sf::Music m_GameOver;         ///< Music for the game over state
 
     // UI
-    sf::Texture m_BackgroundTexture;    ///< Texture for the background
-    sf::Sprite m_BackgroundSprite;     ///< Sprite for the background
-    sf::Sprite m_BackgroundSpriteTwo;  ///< Another sprite for the background (used for parallax effect)
-
-    sf::Font m_Font;           ///< Font used for UI text
-    sf::Text m_LevelText;      ///< Text displaying the current level
-    sf::Text m_LivesText;      ///< Text displaying the player's remaining lives
-    sf::Text m_PausedText;     ///< Text displaying the paused state message
-
-    // Random Number Generator
-    RandomGenerator m_RNG;  ///< Random number generator for enemy spawning
+    std::shared_ptr<sf::Font> m_Font;  ///< Shared font used for UI text
+    HudText m_LevelText;       ///< Text displaying the current level
+    HudText m_LivesText;       ///< Text displaying the player's remaining lives
+    HudText m_PausedText;      ///< Text displaying the paused state message
+
+    std::shared_ptr<sf::Texture> m_WaveBannerTexture;  ///< Texture (atlas page) of the current wave banner
+    sf::Sprite m_WaveBanner;                           ///< "Wave N" banner shown when a wave begins
+    float m_WaveBannerTimeLeft;                        ///< Seconds the banner stays on screen
 
     // Player Lives
     int m_Lives;  ///< The player's remaining lives
@@ -1,5 +1,6 @@
 #include "stdafx.h"
 #include "LevelTwo.h"
+#include "Core/Rendering/RenderSnapshot.h"
 
 LevelTwo::LevelTwo(SceneManager& sceneManager, sf::RenderWindow& window)
 	: m_SceneManager(sceneManager)
@@ -34,7 +35,7 @@ void LevelTwo::Update(float deltaTime)
 
 }
 
-void LevelTwo::Draw()
+void LevelTwo::Draw(RenderSnapshot& snapshot, float alpha)
 {
 
 }
@@ -70,12 +70,15 @@ public:
     void Update(float deltaTime) override;
 
     /**
-     * @brief Draws the level scene to the window.
+     * @brief Records the level scene into the frame's snapshot.
      *
      * This function is called every frame to render all of the elements in the level, including objects,
      * backgrounds, and UI elements.
+     *
+     * @param snapshot The frame being recorded.
+     * @param alpha How far the frame is between the previous tick (0) and the current tick (1).
      */
-    void Draw() override;
+    void Draw(RenderSnapshot& snapshot, float alpha) override;
 
 private:
     // Scene Manager
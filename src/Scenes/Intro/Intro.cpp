@@ -1,19 +1,77 @@
 #include "stdafx.h"
 #include "Intro.h"
+#include "Core/Utility/Strings.h"
+#include "Core/Managers/ResourceCache.h"
+#include "Core/Rendering/RenderSnapshot.h"
+
+// ********************* INTRO CONSTANTS ********************
+constexpr float PROGRESS_BAR_WIDTH = 800.0f;
+constexpr float PROGRESS_BAR_HEIGHT = 24.0f;
+constexpr float PROGRESS_EASE_SPEED = 8.0f;   // How fast the bar catches up with the real progress, per second
+// ****************************************************
 
 Intro::Intro(SceneManager& sceneManager, sf::RenderWindow& window)
 	: m_SceneManager(sceneManager)
 	, m_Window(window)
+	, m_DisplayedProgress(0.0f)
 {
 
 }
 
-void Intro::Update(float deltaTima)
+void Intro::OnInit()
 {
+	const sf::Vector2f center(m_Window.getSize().x * 0.5f, m_Window.getSize().y * 0.5f);
+
+	// Progress bar, centered on the screen
+	m_ProgressFrame.setSize(sf::Vector2f(PROGRESS_BAR_WIDTH, PROGRESS_BAR_HEIGHT));
+	m_ProgressFrame.setPosition(center.x - PROGRESS_BAR_WIDTH * 0.5f, center.y);
+	m_ProgressFrame.setFillColor(sf::Color::Transparent);
+	m_ProgressFrame.setOutlineThickness(2.0f);
+	m_ProgressFrame.setOutlineColor(sf::Color::White);
+
+	m_ProgressBar.setSize(sf::Vector2f(0.0f, PROGRESS_BAR_HEIGHT));
+	m_ProgressBar.setPosition(m_ProgressFrame.getPosition());
+	m_ProgressBar.setFillColor(sf::Color::Blue);
+
+	// The only asset loaded synchronously, it is small and the screen is useless without it
+	m_Font = ResourceCache::Get().GetFont(FONT_A);
+	if (m_Font == nullptr)
+	{
+		Log::Print("Error loading font!", LogLevel::ERROR_);
+		return;
+	}
+
+	m_TitleText.setFont(*m_Font);
+	m_TitleText.setString("MOO WARS");
+	m_TitleText.setCharacterSize(96);
+	m_TitleText.setFillColor(sf::Color::White);
+	m_TitleText.setOutlineThickness(2.0f);
+	m_TitleText.setOutlineColor(sf::Color::Blue);
+	const sf::FloatRect titleRect = m_TitleText.getLocalBounds();
+	m_TitleText.setOrigin(titleRect.left + titleRect.width * 0.5f, titleRect.top + titleRect.height);
+	m_TitleText.setPosition(center.x, center.y - 80.0f);
 
+	m_ProgressText.Init(*m_Font, 24, sf::Vector2f(m_ProgressFrame.getPosition().x, center.y + PROGRESS_BAR_HEIGHT + 16.0f));
+	m_ProgressText.SetLabel("LOADING ", "%");
+	m_ProgressText.SetValue(0);
 }
 
-void Intro::Draw()
+void Intro::Update(float deltaTime)
 {
+	// Ease towards the real progress so the bar does not jump when a batch of small files lands at once
+	const float progress = ResourceCache::Get().GetLoadProgress();
+	m_DisplayedProgress += (progress - m_DisplayedProgress) * std::min(1.0f, PROGRESS_EASE_SPEED * deltaTime);
 
+	m_ProgressBar.setSize(sf::Vector2f(PROGRESS_BAR_WIDTH * m_DisplayedProgress, PROGRESS_BAR_HEIGHT));
+
+	// Changing the string rebuilds the text geometry, SetValue() skips it while the number stays the same
+	m_ProgressText.SetValue(static_cast<int>(progress * 100.0f));
+}
+
+void Intro::Draw(RenderSnapshot& snapshot, float alpha)
+{
+	snapshot.Draw(m_TitleText);
+	snapshot.Draw(m_ProgressFrame);
+	snapshot.Draw(m_ProgressBar);
+	m_ProgressText.Draw(snapshot);
 }
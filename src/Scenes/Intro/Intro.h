@@ -1,14 +1,62 @@
+/*!
+ * \file Intro.h
+ *
+ * \brief Contains the Intro scene, the loading screen shown while the game's assets are decoded in the background.
+ *
+ * \author Felix Atanasescu - HE20830
+ * \date October 2026
+ */
+
 #pragma once
+#include "Core/Rendering/HudText.h"
 
+/**
+ * @class Intro
+ * @brief The first scene of the game, a progress bar over the asynchronous asset loading.
+ *
+ * The scene only needs one small font, so the window shows it on the very first frame. It reads the progress from
+ * the ResourceCache; the GameInstance finishes the loads and switches to the main menu once they are done.
+ */
 class Intro final: public IGameScene
 {
 public:
+	/**
+	 * @brief Constructs the loading screen.
+	 *
+	 * @param sceneManager The scene manager owning this scene.
+	 * @param window The window to draw to.
+	 */
 	Intro(SceneManager& sceneManager, sf::RenderWindow& window);
-	void Update(float deltaTima) override;
-	void Draw() override;
+
+	/**
+	 * @brief Loads the font and lays out the title, the progress bar and its text.
+	 */
+	void OnInit() override;
+
+	/**
+	 * @brief Moves the progress bar towards the current load progress.
+	 *
+	 * @param deltaTime Time elapsed since the last tick, in seconds.
+	 */
+	void Update(float deltaTime) override;
+
+	/**
+	 * @brief Draws the title and the progress bar.
+	 *
+	 * @param snapshot The frame being recorded.
+	 * @param alpha Unused, nothing on the loading screen is simulated.
+	 */
+	void Draw(RenderSnapshot& snapshot, float alpha) override;
 
 private:
-	SceneManager& m_SceneManager;
-	sf::RenderWindow& m_Window;
-};
+	SceneManager& m_SceneManager;          ///< The scene manager owning this scene
+	sf::RenderWindow& m_Window;            ///< The window to draw to
+
+	std::shared_ptr<sf::Font> m_Font;      ///< Font of the title and the progress text
+	sf::Text m_TitleText;                  ///< The game's name
+	HudText m_ProgressText;                ///< "LOADING 42%"
+	sf::RectangleShape m_ProgressFrame;    ///< Outline of the progress bar
+	sf::RectangleShape m_ProgressBar;      ///< Filled part of the progress bar
 
+	float m_DisplayedProgress;             ///< Progress shown by the bar, eased towards the real progress
+};
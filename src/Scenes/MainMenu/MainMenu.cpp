@@ -1,8 +1,10 @@
 #include "stdafx.h"
-#include "Core/Utility/strings.h"
+#include "Core/Utility/Strings.h"
 #include "MainMenu.h"
 #include "Core/Managers/InputManager.h"
 #include "Core/Utility/Helper.h"
+#include "Core/Managers/ResourceCache.h"
+#include "Core/Rendering/RenderSnapshot.h"
 
 // Button layout constants
 constexpr int BUTTON_SIZE_X = 500;
@@ -37,16 +39,16 @@ void MenuState::Update(float deltaTime)
 	UpdateButtons();
 }
 
-void MenuState::Draw()
+void MenuState::Draw(RenderSnapshot& snapshot, float alpha)
 {
-	m_Window.draw(m_Background);
+	snapshot.Draw(m_Background);
 
 	for (const auto& button : m_Buttons)
 	{
-		m_Window.draw(button.sprite);
+		snapshot.Draw(button.sprite);
 	}
 
-	m_Window.draw(m_Cursor);
+	snapshot.Draw(m_Cursor);
 }
 
 void MenuState::HandleInput(float deltaTime)
@@ -64,7 +66,7 @@ void MenuState::HandleInput(float deltaTime)
 				m_StateManager.Switch(SceneID::CREDITS);
 				break;
 			case ButtonAction::EXIT:
-				m_Window.close();
+				m_StateManager.RequestQuit();
 				break;
 			}
 		}
@@ -72,7 +74,7 @@ void MenuState::HandleInput(float deltaTime)
 
 	if (InputManager::Get().IsKeyPress(KeyBind::Pause))
 	{
-		m_Window.close();
+		m_StateManager.RequestQuit();
 	}
 
 	InputManager::Get().Update(deltaTime);
@@ -81,7 +83,8 @@ void MenuState::HandleInput(float deltaTime)
 void MenuState::InitButtons()
 {
 	// Attempt to load the texture from the specified file
-	if (!m_ButtonTexture.loadFromFile(BUTTONS_SPRITESHEET))
+	m_ButtonTexture = ResourceCache::Get().GetTexture(BUTTONS_SPRITESHEET);
+	if (m_ButtonTexture == nullptr)
 	{
 		// Log an error if the texture loading fails
 		Log::Print("Texture failed to load! ", LogLevel::ERROR_);
@@ -113,7 +116,7 @@ void MenuState::InitButtons()
 	// Init and store
 	for (auto& btn : { &start, &credits, &exit })
 	{
-		btn->Init(m_ButtonTexture);
+		btn->Init(*m_ButtonTexture);
 		m_Buttons.push_back(*btn);
 	}
 
@@ -131,8 +134,8 @@ void MenuState::UpdateButtons()
 
 void MenuState::UpdateCursor()
 {
-	// Get mouse position relative to the window
-	m_MousePos = sf::Mouse::getPosition(m_Window); // Pass the window object here
+	// Cursor position of the tick, live or replayed
+	m_MousePos = InputManager::Get().GetCursorPosition();
 
 	// Update the cursor position
 	m_Cursor.setPosition(static_cast<float>(m_MousePos.x), static_cast<float>(m_MousePos.y));
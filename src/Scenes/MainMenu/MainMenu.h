@@ -118,11 +118,14 @@ public:
     void Update(float deltaTime) override;
 
     /**
-     * @brief Draws the menu scene to the window.
+     * @brief Records the menu scene into the frame's snapshot.
      *
      * This function is called to render the menu, including background, buttons, and cursor.
+     *
+     * @param snapshot The frame being recorded.
+     * @param alpha The interpolation factor between simulation ticks (unused, the menu has no moving objects).
      */
-    void Draw() override;
+    void Draw(RenderSnapshot& snapshot, float alpha) override;
 
     /**
      * @brief Handles user input in the menu scene.
@@ -164,9 +167,9 @@ private:
     sf::Sprite m_Cursor;          ///< The cursor sprite in the menu
 
     // Textures
-    sf::Texture m_BackgroundTexture; ///< The texture for the background
-    sf::Texture m_CursorTexture;     ///< The texture for the cursor
-    sf::Texture m_ButtonTexture;     ///< The texture for the buttons
+    std::shared_ptr<sf::Texture> m_BackgroundTexture; ///< The shared texture for the background
+    std::shared_ptr<sf::Texture> m_CursorTexture;     ///< The shared texture for the cursor
+    std::shared_ptr<sf::Texture> m_ButtonTexture;     ///< The shared texture for the buttons
 
     // Menu buttons and actions
     std::vector<MenuButton> m_Buttons;          ///< List of menu buttons
@@ -1,7 +1,45 @@
 #include "stdafx.h"
 #include "GameInstance.h"
+#include "Core/Memory/MemoryTracker.h"
 #include <Windows.h>
 
+namespace
+{
+	/**
+	 * @brief Applies the command line options to the game before it runs.
+	 *
+	 * --record=<file> saves the input of the session to the file on exit; --replay=<file> plays a saved session back
+	 * instead of the mouse and keyboard, and exits when it ends. --memory-budget=<tag>:<MiB> changes the budget of a
+	 * MemoryTracker tag, e.g. --memory-budget=textures:128.
+	 */
+	void ApplyCommandLine(GameInstance& instance, int argc, char** argv)
+	{
+		const std::string recordOption = "--record=";
+		const std::string replayOption = "--replay=";
+		const std::string memoryBudgetOption = "--memory-budget=";
+
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string argument = argv[i];
+			if (argument.rfind(recordOption, 0) == 0)
+			{
+				instance.RecordInput(argument.substr(recordOption.size()));
+			}
+			else if (argument.rfind(replayOption, 0) == 0)
+			{
+				instance.ReplayInput(argument.substr(replayOption.size()));
+			}
+			else if (argument.rfind(memoryBudgetOption, 0) == 0)
+			{
+				if (!MemoryTracker::Get().ParseBudget(argument.substr(memoryBudgetOption.size())))
+				{
+					Log::Print("Invalid memory budget", argument, LogLevel::WARNING);
+				}
+			}
+		}
+	}
+}
+
 #ifdef _DEBUG
 /**
  * @brief Entry point for the game in debug mode.
@@ -10,11 +48,14 @@
  * the `GameInstance` class and calls its `Run()` method to start the game. The game loop will run
  * until the game ends. This function will return 0 upon successful completion.
  *
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments, see ApplyCommandLine().
  * @return int Returns 0 if the game runs successfully.
  */
-int main()
+int main(int argc, char** argv)
 {
 	GameInstance instance; ///< Create a new instance of the game.
+	ApplyCommandLine(instance, argc, argv);
 	instance.Run();        ///< Start the game loop.
 	return 0;              ///< Return 0 to indicate successful execution.
 }
@@ -33,6 +74,7 @@ int main()
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nShowCmd)
 {
 	GameInstance instance; ///< Create a new instance of the game.
+	ApplyCommandLine(instance, __argc, __argv); // The CRT splits the command line for WinMain too
 	instance.Run();        ///< Start the game loop.
 	return 0;              ///< Return 0 to indicate successful execution.
 }
@@ -11,6 +11,11 @@
 #include <array>
 #include <cmath>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <chrono>
 #include <fstream>
 #include <istream>
 #include <ostream>
@@ -31,6 +36,7 @@
 #include "Core/Utility/Vector2.h"
 #include "Core/Utility/Timer.h"
 #include "Core/Utility/RandomGen.h"
+#include "Core/Utility/Profiler.h"
 
 // Managers
 #include "Core/Managers/SceneManager.h"
@@ -39,5 +45,7 @@
 #include "Entities/Cursor.h"
 
 // WIN Dependencies
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include <sstream>